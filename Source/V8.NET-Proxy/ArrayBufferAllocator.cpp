@@ -0,0 +1,143 @@
+#include "ProxyTypes.h"
+
+// ------------------------------------------------------------------------------------------------------------------------
+
+PooledArrayBufferAllocator::PooledArrayBufferAllocator()
+	: _MaxBytes(0), _MaxPooledBytes(4 * 1024 * 1024)
+{
+	memset(&_Stats, 0, sizeof(_Stats));
+}
+
+PooledArrayBufferAllocator::~PooledArrayBufferAllocator()
+{
+	for (auto i = 0; i < SizeClassCount; i++)
+	{
+		for (size_t j = 0; j < _FreeBlocks[i].size(); j++)
+			free(_FreeBlocks[i][j]);
+		_FreeBlocks[i].clear();
+	}
+}
+
+// ------------------------------------------------------------------------------------------------------------------------
+
+// Returns the size class index for blocks of the given length, or -1 if blocks of this length are not pooled.
+int32_t PooledArrayBufferAllocator::_GetSizeClass(size_t length)
+{
+	if (length > ((size_t)1 << MaxBlockSizeBits)) return -1;
+
+	int32_t bits = MinBlockSizeBits;
+	while (((size_t)1 << bits) < length)
+		bits++;
+
+	return bits - MinBlockSizeBits;
+}
+
+void* PooledArrayBufferAllocator::_Allocate(size_t length, bool zeroFill)
+{
+	auto sizeClass = _GetSizeClass(length);
+	void* data = nullptr;
+
+	{
+		lock_guard<std::mutex> lock(_Mutex);
+
+		if (_MaxBytes > 0 && _Stats.AllocatedBytes + (int64_t)length > _MaxBytes)
+		{
+			_Stats.FailedAllocationCount++;
+			return nullptr; // (V8 will throw a 'RangeError' in the script)
+		}
+
+		if (sizeClass >= 0 && !_FreeBlocks[sizeClass].empty())
+		{
+			data = _FreeBlocks[sizeClass].back();
+			_FreeBlocks[sizeClass].pop_back();
+			_Stats.PooledBytes -= (int64_t)1 << (sizeClass + MinBlockSizeBits);
+		}
+
+		// ... reserve the bytes now (while locked), so other threads can't go over the limit at the same time ...
+
+		_Stats.AllocatedBytes += length;
+		if (_Stats.AllocatedBytes > _Stats.PeakBytes)
+			_Stats.PeakBytes = _Stats.AllocatedBytes;
+		_Stats.AllocationCount++;
+	}
+
+	if (data == nullptr)
+	{
+		auto size = sizeClass >= 0 ? (size_t)1 << (sizeClass + MinBlockSizeBits) : length;
+		data = zeroFill ? calloc(size > 0 ? size : 1, 1) : malloc(size > 0 ? size : 1);
+
+		if (data == nullptr)
+		{
+			lock_guard<std::mutex> lock(_Mutex);
+			_Stats.AllocatedBytes -= length;
+			_Stats.AllocationCount--;
+			_Stats.FailedAllocationCount++;
+			return nullptr;
+		}
+	}
+	else if (zeroFill)
+		memset(data, 0, length); // (a reused block; only the requested part needs to be cleared, since V8 never reads past it)
+
+	return data;
+}
+
+void PooledArrayBufferAllocator::Free(void* data, size_t length)
+{
+	if (data == nullptr) return;
+
+	auto sizeClass = _GetSizeClass(length);
+
+	{
+		lock_guard<std::mutex> lock(_Mutex);
+
+		_Stats.AllocatedBytes -= length;
+
+		if (sizeClass >= 0)
+		{
+			auto blockSize = (int64_t)1 << (sizeClass + MinBlockSizeBits);
+
+			if (_Stats.PooledBytes + blockSize <= _MaxPooledBytes)
+			{
+				_FreeBlocks[sizeClass].push_back(data);
+				_Stats.PooledBytes += blockSize;
+				return;
+			}
+		}
+	}
+
+	free(data);
+}
+
+// ------------------------------------------------------------------------------------------------------------------------
+
+// Frees pooled blocks until the pool is within its limit (the lock must be held).
+void PooledArrayBufferAllocator::_TrimPool()
+{
+	for (auto i = SizeClassCount - 1; i >= 0 && _Stats.PooledBytes > _MaxPooledBytes; i--)
+		while (!_FreeBlocks[i].empty() && _Stats.PooledBytes > _MaxPooledBytes)
+		{
+			free(_FreeBlocks[i].back());
+			_FreeBlocks[i].pop_back();
+			_Stats.PooledBytes -= (int64_t)1 << (i + MinBlockSizeBits);
+		}
+}
+
+void PooledArrayBufferAllocator::SetLimits(int64_t maxBytes, int64_t maxPooledBytes)
+{
+	lock_guard<std::mutex> lock(_Mutex);
+
+	_MaxBytes = maxBytes > 0 ? maxBytes : 0;
+	_MaxPooledBytes = maxPooledBytes > 0 ? maxPooledBytes : 0;
+
+	_TrimPool();
+}
+
+void PooledArrayBufferAllocator::GetStats(ArrayBufferAllocatorStats &stats)
+{
+	lock_guard<std::mutex> lock(_Mutex);
+
+	stats = _Stats;
+	stats.MaxBytes = _MaxBytes;
+}
+
+// ------------------------------------------------------------------------------------------------------------------------
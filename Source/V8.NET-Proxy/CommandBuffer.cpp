@@ -0,0 +1,294 @@
+#include "ProxyTypes.h"
+
+// ------------------------------------------------------------------------------------------------------------------------
+
+CommandInterpreter::CommandInterpreter(V8EngineProxy* engineProxy, const byte* data, int32_t length, PrimitiveValue* results, int32_t resultCapacity)
+	: _EngineProxy(engineProxy), _Context(engineProxy->Context()), _Data(data), _Length(data != nullptr ? length : 0), _Position(0),
+	_Results(results), _ResultCapacity(results != nullptr ? resultCapacity : 0), _ResultCount(0), _Error(nullptr)
+{
+}
+
+// ------------------------------------------------------------------------------------------------------------------------
+
+template <typename T> bool CommandInterpreter::_Read(T &value)
+{
+	if (_Position + (int64_t)sizeof(T) > _Length)
+	{
+		_Error = "ExecuteCommandBuffer(): A command is missing its operands.";
+		return false;
+	}
+	memcpy(&value, _Data + _Position, sizeof(T));
+	_Position += sizeof(T);
+	return true;
+}
+
+bool CommandInterpreter::_Pop(Local<Value> &value)
+{
+	if (_Stack.empty())
+	{
+		_Error = "ExecuteCommandBuffer(): A command expected more values on the stack.";
+		return false;
+	}
+	value = _Stack.back();
+	_Stack.pop_back();
+	return true;
+}
+
+bool CommandInterpreter::_PopObject(Local<Object> &obj)
+{
+	Local<Value> value;
+	if (!_Pop(value)) return false;
+	if (!value->IsObject())
+	{
+		_Error = "ExecuteCommandBuffer(): A command expected an object on the stack.";
+		return false;
+	}
+	obj = value.As<Object>();
+	return true;
+}
+
+bool CommandInterpreter::_GetName(int32_t id, Local<String> &name)
+{
+	name = _EngineProxy->GetCommandName(id);
+	if (name.IsEmpty())
+	{
+		_Error = "ExecuteCommandBuffer(): A command referenced a property name ID that was not registered.";
+		return false;
+	}
+	return true;
+}
+
+// Calls 'function' with the last 'argCount' values on the stack (which are removed), then pushes the result.
+bool CommandInterpreter::_Call(int32_t argCount, Local<Value> function, Local<Value> _this)
+{
+	if (!function->IsFunction())
+	{
+		_Error = "ExecuteCommandBuffer(): A call command expected a function.";
+		return false;
+	}
+
+	auto start = _Stack.size() - argCount;
+	auto result = function.As<Function>()->Call(_Context, _this, argCount, argCount > 0 ? &_Stack[start] : nullptr);
+	_Stack.resize(start);
+
+	Local<Value> value;
+	if (!result.ToLocal(&value)) return false; // (the caller checks the try/catch)
+	_Stack.push_back(value);
+	return true;
+}
+
+// ------------------------------------------------------------------------------------------------------------------------
+
+bool CommandInterpreter::_Run(CommandOpCode op)
+{
+	switch (op)
+	{
+	case CO_PushUndefined: _Stack.push_back(V8Undefined); return true;
+	case CO_PushNull: _Stack.push_back(V8Null); return true;
+	case CO_PushBool:
+	{
+		byte b;
+		if (!_Read(b)) return false;
+		_Stack.push_back(NewBool(b != 0));
+		return true;
+	}
+	case CO_PushInt32:
+	{
+		int32_t i;
+		if (!_Read(i)) return false;
+		_Stack.push_back(NewInteger(i));
+		return true;
+	}
+	case CO_PushNumber:
+	{
+		double n;
+		if (!_Read(n)) return false;
+		_Stack.push_back(NewNumber(n));
+		return true;
+	}
+	case CO_PushString:
+	{
+		int32_t length;
+		if (!_Read(length)) return false;
+		if (length < 0 || _Position + (int64_t)length * (int64_t)sizeof(uint16_t) > _Length)
+		{
+			_Error = "ExecuteCommandBuffer(): A string is longer than the command buffer.";
+			return false;
+		}
+		Local<String> str;
+		if (!String::NewFromTwoByte(_EngineProxy->Isolate(), (const uint16_t*)(_Data + _Position), NewStringType::kNormal, length).ToLocal(&str))
+		{
+			_Error = "ExecuteCommandBuffer(): A string is too long.";
+			return false;
+		}
+		_Position += length * sizeof(uint16_t);
+		_Stack.push_back(str);
+		return true;
+	}
+	case CO_PushHandle:
+	{
+		int32_t engineID, id, generation;
+		if (!_Read(engineID) || !_Read(id) || !_Read(generation)) return false;
+		if (id < 0) { _Stack.push_back(V8Undefined); return true; }
+
+		// ... the handle is looked up by ID, so a handle that was disposed (even if its ID was since reused), or belongs to another engine, fails
+		// instead of being used ...
+
+		auto handleProxy = _EngineProxy->GetHandleProxyByID(id);
+		if (handleProxy == nullptr || handleProxy->EngineID() != engineID || handleProxy->Generation() != generation)
+		{
+			_Error = "ExecuteCommandBuffer(): A handle was disposed, or belongs to another engine.";
+			return false;
+		}
+		_Stack.push_back(handleProxy->Handle());
+		return true;
+	}
+	case CO_PushGlobal: _Stack.push_back(_Context->Global()); return true;
+	case CO_CreateObject: _Stack.push_back(NewObject()); return true;
+	case CO_CreateArray:
+	{
+		int32_t length;
+		if (!_Read(length)) return false;
+		_Stack.push_back(NewArray(length > 0 ? length : 0));
+		return true;
+	}
+	case CO_Dup:
+	{
+		if (_Stack.empty()) { _Error = "ExecuteCommandBuffer(): There is no value to duplicate."; return false; }
+		_Stack.push_back(_Stack.back());
+		return true;
+	}
+	case CO_Pop:
+	{
+		Local<Value> value;
+		return _Pop(value);
+	}
+	case CO_GetProperty:
+	{
+		int32_t id;
+		Local<String> name;
+		Local<Object> obj;
+		Local<Value> value;
+		if (!_Read(id) || !_GetName(id, name) || !_PopObject(obj)) return false;
+		if (!obj->Get(_Context, name).ToLocal(&value)) return false;
+		_Stack.push_back(value);
+		return true;
+	}
+	case CO_SetProperty:
+	{
+		int32_t id;
+		Local<String> name;
+		Local<Value> value;
+		Local<Object> obj;
+		if (!_Read(id) || !_GetName(id, name) || !_Pop(value) || !_PopObject(obj)) return false;
+		if (!obj->Set(_Context, name, value).FromMaybe(false)) return false;
+		_Stack.push_back(obj);
+		return true;
+	}
+	case CO_GetIndex:
+	{
+		int32_t index;
+		Local<Object> obj;
+		Local<Value> value;
+		if (!_Read(index) || !_PopObject(obj)) return false;
+		if (!obj->Get(_Context, (uint32_t)index).ToLocal(&value)) return false;
+		_Stack.push_back(value);
+		return true;
+	}
+	case CO_SetIndex:
+	{
+		int32_t index;
+		Local<Value> value;
+		Local<Object> obj;
+		if (!_Read(index) || !_Pop(value) || !_PopObject(obj)) return false;
+		if (!obj->Set(_Context, (uint32_t)index, value).FromMaybe(false)) return false;
+		_Stack.push_back(obj);
+		return true;
+	}
+	case CO_Call:
+	{
+		int32_t argCount;
+		if (!_Read(argCount)) return false;
+		if (argCount < 0 || (size_t)argCount + 2 > _Stack.size())
+		{
+			_Error = "ExecuteCommandBuffer(): A call command expected more values on the stack.";
+			return false;
+		}
+		auto function = _Stack[_Stack.size() - argCount - 2];
+		auto _this = _Stack[_Stack.size() - argCount - 1];
+		if (!_Call(argCount, function, _this)) return false;
+		auto result = _Stack.back();
+		_Stack.resize(_Stack.size() - 3); // (remove the result, 'this', and the function)
+		_Stack.push_back(result);
+		return true;
+	}
+	case CO_CallMethod:
+	{
+		int32_t id, argCount;
+		Local<String> name;
+		if (!_Read(id) || !_Read(argCount) || !_GetName(id, name)) return false;
+		if (argCount < 0 || (size_t)argCount + 1 > _Stack.size())
+		{
+			_Error = "ExecuteCommandBuffer(): A call command expected more values on the stack.";
+			return false;
+		}
+		auto subject = _Stack[_Stack.size() - argCount - 1];
+		if (!subject->IsObject())
+		{
+			_Error = "ExecuteCommandBuffer(): A method call command expected an object on the stack.";
+			return false;
+		}
+		Local<Value> function;
+		if (!subject.As<Object>()->Get(_Context, name).ToLocal(&function)) return false;
+		if (!_Call(argCount, function, subject)) return false;
+		auto result = _Stack.back();
+		_Stack.resize(_Stack.size() - 2); // (remove the result and the object)
+		_Stack.push_back(result);
+		return true;
+	}
+	case CO_Read:
+	{
+		Local<Value> value;
+		if (!_Pop(value)) return false;
+		if (_ResultCount >= _ResultCapacity)
+		{
+			_Error = "ExecuteCommandBuffer(): There are more values read than there are results.";
+			return false;
+		}
+		_EngineProxy->GetPrimitiveValue(value, _Results[_ResultCount++]);
+		return true;
+	}
+	default:
+		_Error = "ExecuteCommandBuffer(): Invalid command op code.";
+		return false;
+	}
+}
+
+// ------------------------------------------------------------------------------------------------------------------------
+
+HandleProxy* CommandInterpreter::Execute()
+{
+	TryCatch __tryCatch(_EngineProxy->Isolate());
+
+	_Position = 0;
+	_ResultCount = 0;
+	_Stack.clear();
+	_Error = nullptr;
+
+	while (_Position < _Length)
+	{
+		auto op = (CommandOpCode)_Data[_Position++];
+		if (op == CO_End) break;
+
+		if (!_Run(op) || __tryCatch.HasCaught())
+		{
+			if (__tryCatch.HasCaught())
+				return _EngineProxy->GetErrorHandleProxy(__tryCatch, JSV_ExecutionError);
+			return _EngineProxy->CreateError(_Error != nullptr ? _Error : "ExecuteCommandBuffer(): A command failed.", JSV_InternalError);
+		}
+	}
+
+	return nullptr;
+}
+
+// ------------------------------------------------------------------------------------------------------------------------
@@ -0,0 +1,285 @@
+#include "ProxyTypes.h"
+
+// ------------------------------------------------------------------------------------------------------------------------
+
+// Internal fields of the row view ("rows") and row objects.  The dataset object is kept alive through the 'PK_Dataset' private key, since any
+// object with more than one internal field has the managed object ID stored in the second field when it is wrapped (see 'ConnectObject()').
+enum DatasetField
+{
+	DF_Dataset, // (aligned pointer to the 'Dataset' instance)
+	DF_ManagedObjectID, // (reserved for the managed object ID; row objects only)
+	DF_RowIndex, // (row objects only)
+	DF_Count
+};
+
+// ------------------------------------------------------------------------------------------------------------------------
+
+Dataset::Dataset(V8EngineProxy* engineProxy, int32_t rowCount, const DatasetColumnInfo* columns, int32_t columnCount, ManagedReleaseCallback releaseCallback, int32_t releaseID)
+	: _EngineProxy(engineProxy), _RowCount(rowCount), _Columns(nullptr), _ColumnCount(columnCount), _ReleaseCallback(releaseCallback), _ReleaseID(releaseID)
+{
+	_Columns = new _Column[columnCount];
+
+	for (auto i = 0; i < columnCount; i++)
+	{
+		auto &column = _Columns[i];
+		Local<String> name = NewInternalizedUString(columns[i].Name);
+		column.Name = name;
+		column.Type = columns[i].Type;
+		column.Data = columns[i].Data;
+		column.Dictionary = nullptr;
+		column.DictionarySize = 0;
+
+		if (column.Type == DC_String)
+		{
+			// ... the dictionary strings are created once here, so reading a string field never creates a new string ...
+
+			column.DictionarySize = columns[i].DictionarySize;
+			column.Dictionary = new CopyablePersistent<String>[column.DictionarySize];
+			for (auto s = 0; s < column.DictionarySize; s++)
+			{
+				auto str = columns[i].Dictionary[s];
+				Local<String> value = str != nullptr ? NewUString(str) : NewString("");
+				column.Dictionary[s] = value;
+			}
+		}
+	}
+}
+
+Dataset::~Dataset()
+{
+	for (auto i = 0; i < _ColumnCount; i++)
+	{
+		auto &column = _Columns[i];
+		column.Name.Reset();
+		if (column.Dictionary != nullptr)
+		{
+			for (auto s = 0; s < column.DictionarySize; s++)
+				column.Dictionary[s].Reset();
+			delete[] column.Dictionary;
+		}
+	}
+
+	delete[] _Columns;
+	_Columns = nullptr;
+
+	_Object.Reset();
+
+	if (_ReleaseCallback != nullptr)
+	{
+		_EngineProxy->_InCallbackScope++;
+		_ReleaseCallback(nullptr, 0, _ReleaseID);
+		_EngineProxy->_InCallbackScope--;
+	}
+
+	_EngineProxy = nullptr;
+}
+
+// ------------------------------------------------------------------------------------------------------------------------
+
+Local<ObjectTemplate> Dataset::CreateRowsTemplate()
+{
+	auto templ = NewObjectTemplate();
+	templ->SetInternalFieldCount(DF_Dataset + 1); // (a single field, so the managed object ID is kept in a private value if wrapped)
+	templ->SetHandler(IndexedPropertyHandlerConfiguration(_GetRow, nullptr, _QueryRow, nullptr, _EnumerateRows));
+	return templ;
+}
+
+Local<ObjectTemplate> Dataset::CreateRowTemplate()
+{
+	auto templ = NewObjectTemplate();
+	templ->SetInternalFieldCount(DF_Count);
+	templ->SetHandler(NamedPropertyHandlerConfiguration(_GetField, nullptr, _QueryField, nullptr, _EnumerateFields));
+	return templ;
+}
+
+// ------------------------------------------------------------------------------------------------------------------------
+
+MaybeLocal<Object> Dataset::CreateObject()
+{
+	auto isolate = _EngineProxy->Isolate();
+	auto ctx = _EngineProxy->Context();
+	auto obj = NewObject();
+	auto columns = NewObject();
+	auto dictionaries = NewObject();
+
+	for (auto i = 0; i < _ColumnCount; i++)
+	{
+		auto &column = _Columns[i];
+		auto elementSize = column.Type == DC_Number ? sizeof(double) : sizeof(int32_t);
+
+		// ... the buffer is 'externalized', so V8 never frees the memory; it is released with the dataset, which each buffer keeps alive ...
+
+		auto buffer = ArrayBuffer::New(isolate, column.Data, (size_t)_RowCount * elementSize, ArrayBufferCreationMode::kExternalized);
+		buffer->SetPrivate(ctx, _EngineProxy->GetPrivateKey(PK_Dataset), obj);
+
+		Local<Value> view;
+		if (column.Type == DC_Number)
+			view = Float64Array::New(buffer, 0, (size_t)_RowCount);
+		else
+			view = Int32Array::New(buffer, 0, (size_t)_RowCount);
+		if (!columns->CreateDataProperty(ctx, column.Name.Handle(), view).FromMaybe(false))
+			return MaybeLocal<Object>();
+
+		if (column.Type == DC_String)
+		{
+			auto strings = NewArray(column.DictionarySize);
+			for (auto s = 0; s < column.DictionarySize; s++)
+				if (!strings->CreateDataProperty(ctx, (uint32_t)s, column.Dictionary[s].Handle()).FromMaybe(false))
+					return MaybeLocal<Object>();
+			if (!dictionaries->CreateDataProperty(ctx, column.Name.Handle(), strings).FromMaybe(false))
+				return MaybeLocal<Object>();
+		}
+	}
+
+	Local<Object> rows;
+	if (!_EngineProxy->_DatasetRowsTemplate->NewInstance(ctx).ToLocal(&rows))
+		return MaybeLocal<Object>();
+	rows->SetAlignedPointerInInternalField(DF_Dataset, this);
+	rows->SetPrivate(ctx, _EngineProxy->GetPrivateKey(PK_Dataset), obj);
+
+	if (!rows->CreateDataProperty(ctx, NewString("length"), NewInteger(_RowCount)).FromMaybe(false)
+		|| !obj->CreateDataProperty(ctx, NewString("length"), NewInteger(_RowCount)).FromMaybe(false)
+		|| !obj->CreateDataProperty(ctx, NewString("columns"), columns).FromMaybe(false)
+		|| !obj->CreateDataProperty(ctx, NewString("dictionaries"), dictionaries).FromMaybe(false)
+		|| !obj->CreateDataProperty(ctx, NewString("rows"), rows).FromMaybe(false))
+		return MaybeLocal<Object>();
+
+	_Object = obj;
+	_Object.Value.SetWeak<Dataset>(this, _WeakCallback, WeakCallbackType::kParameter);
+
+	return obj;
+}
+
+void Dataset::_WeakCallback(const WeakCallbackInfo<Dataset>& data)
+{
+	// ... only the handle may be reset in the first pass; the other handles and the managed side callback have to wait for the second pass ...
+
+	data.GetParameter()->_Object.Reset();
+	data.SetSecondPassCallback(_ReleaseCallback);
+}
+
+void Dataset::_ReleaseCallback(const WeakCallbackInfo<Dataset>& data)
+{
+	auto engineProxy = (V8EngineProxy*)data.GetIsolate()->GetData(0);
+	if (engineProxy->_Datasets.count(data.GetParameter()) > 0) // (the engine may have released it in the meantime)
+		engineProxy->_ReleaseDataset(data.GetParameter());
+}
+
+// ------------------------------------------------------------------------------------------------------------------------
+
+Local<Value> Dataset::GetValue(int32_t column, int32_t row)
+{
+	auto &col = _Columns[column];
+
+	switch (col.Type)
+	{
+	case DC_Number: return NewNumber(((double*)col.Data)[row]);
+	case DC_Int32: return NewInteger(((int32_t*)col.Data)[row]);
+	case DC_String:
+	{
+		auto index = ((int32_t*)col.Data)[row];
+		if (index < 0 || index >= col.DictionarySize) return V8Null;
+		return col.Dictionary[index].Handle();
+	}
+	default: return V8Undefined;
+	}
+}
+
+int32_t Dataset::_FindColumn(Local<Name> name)
+{
+	// ... property names are internalized, so this is usually just a pointer comparison ...
+
+	for (auto i = 0; i < _ColumnCount; i++)
+		if (name == _Columns[i].Name.Handle())
+			return i;
+
+	if (!name->IsString()) return -1;
+
+	for (auto i = 0; i < _ColumnCount; i++)
+		if (name->StrictEquals(_Columns[i].Name.Handle()))
+			return i;
+
+	return -1;
+}
+
+// ------------------------------------------------------------------------------------------------------------------------
+
+void Dataset::_GetRow(uint32_t index, const PropertyCallbackInfo<Value>& info)
+{
+	auto rows = info.Holder();
+	auto dataset = reinterpret_cast<Dataset*>(rows->GetAlignedPointerFromInternalField(DF_Dataset));
+	if (dataset == nullptr || index >= (uint32_t)dataset->_RowCount) return; // (not intercepted)
+
+	auto engine = dataset->_EngineProxy;
+	auto ctx = engine->Context();
+	auto datasetKey = engine->GetPrivateKey(PK_Dataset);
+	Local<Value> datasetObject;
+	if (!rows->GetPrivate(ctx, datasetKey).ToLocal(&datasetObject)) return;
+
+	Local<Object> row;
+	if (!engine->_DatasetRowTemplate->NewInstance(ctx).ToLocal(&row)) return; // (an exception is pending)
+	row->SetAlignedPointerInInternalField(DF_Dataset, dataset);
+	row->SetPrivate(ctx, datasetKey, datasetObject);
+	row->SetInternalField(DF_RowIndex, NewInteger((int32_t)index));
+
+	info.GetReturnValue().Set(row);
+}
+
+void Dataset::_QueryRow(uint32_t index, const PropertyCallbackInfo<Integer>& info)
+{
+	auto dataset = reinterpret_cast<Dataset*>(info.Holder()->GetAlignedPointerFromInternalField(DF_Dataset));
+	if (dataset != nullptr && index < (uint32_t)dataset->_RowCount)
+		info.GetReturnValue().Set(ReadOnly | DontDelete);
+}
+
+void Dataset::_EnumerateRows(const PropertyCallbackInfo<Array>& info)
+{
+	auto dataset = reinterpret_cast<Dataset*>(info.Holder()->GetAlignedPointerFromInternalField(DF_Dataset));
+	if (dataset == nullptr) return;
+
+	auto ctx = dataset->_EngineProxy->Context();
+	auto indexes = NewArray(dataset->_RowCount);
+	for (auto i = 0; i < dataset->_RowCount; i++)
+		if (!indexes->CreateDataProperty(ctx, (uint32_t)i, NewInteger(i)).FromMaybe(false))
+			return; // (an exception is pending)
+
+	info.GetReturnValue().Set(indexes);
+}
+
+// ------------------------------------------------------------------------------------------------------------------------
+
+void Dataset::_GetField(Local<Name> name, const PropertyCallbackInfo<Value>& info)
+{
+	auto row = info.Holder();
+	auto dataset = reinterpret_cast<Dataset*>(row->GetAlignedPointerFromInternalField(DF_Dataset));
+	if (dataset == nullptr) return;
+
+	auto column = dataset->_FindColumn(name);
+	if (column < 0) return; // (not intercepted; continue the lookup normally [i.e. the prototype chain])
+
+	auto index = row->GetInternalField(DF_RowIndex).As<Int32>()->Value();
+	info.GetReturnValue().Set(dataset->GetValue(column, index));
+}
+
+void Dataset::_QueryField(Local<Name> name, const PropertyCallbackInfo<Integer>& info)
+{
+	auto dataset = reinterpret_cast<Dataset*>(info.Holder()->GetAlignedPointerFromInternalField(DF_Dataset));
+	if (dataset != nullptr && dataset->_FindColumn(name) >= 0)
+		info.GetReturnValue().Set(ReadOnly | DontDelete);
+}
+
+void Dataset::_EnumerateFields(const PropertyCallbackInfo<Array>& info)
+{
+	auto dataset = reinterpret_cast<Dataset*>(info.Holder()->GetAlignedPointerFromInternalField(DF_Dataset));
+	if (dataset == nullptr) return;
+
+	auto ctx = dataset->_EngineProxy->Context();
+	auto names = NewArray(dataset->_ColumnCount);
+	for (auto i = 0; i < dataset->_ColumnCount; i++)
+		if (!names->CreateDataProperty(ctx, (uint32_t)i, dataset->_Columns[i].Name.Handle()).FromMaybe(false))
+			return; // (an exception is pending)
+
+	info.GetReturnValue().Set(names);
+}
+
+// ------------------------------------------------------------------------------------------------------------------------
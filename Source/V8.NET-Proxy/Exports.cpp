@@ -3,7 +3,102 @@
 // ############################################################################################################################
 // Misc. Global Functions
 
-// ...
+// Encodes UTF-16 characters as UTF-8 into 'bytes' (which must have room for 3 bytes per character) and returns the number of bytes written.
+// Unpaired surrogates are replaced with U+FFFD (the same as 'String::REPLACE_INVALID_UTF8').
+static int32_t _EncodeUtf8(const uint16_t* chars, int32_t count, char* bytes)
+{
+	int32_t n = 0;
+
+	for (int32_t i = 0; i < count; i++)
+	{
+		uint32_t c = chars[i];
+
+		if (c >= 0xD800 && c <= 0xDFFF)
+		{
+			if (c <= 0xDBFF && i + 1 < count && chars[i + 1] >= 0xDC00 && chars[i + 1] <= 0xDFFF)
+				c = 0x10000 + ((c - 0xD800) << 10) + (chars[++i] - 0xDC00);
+			else
+				c = 0xFFFD;
+		}
+
+		if (c < 0x80)
+			bytes[n++] = (char)c;
+		else if (c < 0x800)
+		{
+			bytes[n++] = (char)(0xC0 | (c >> 6));
+			bytes[n++] = (char)(0x80 | (c & 0x3F));
+		}
+		else if (c < 0x10000)
+		{
+			bytes[n++] = (char)(0xE0 | (c >> 12));
+			bytes[n++] = (char)(0x80 | ((c >> 6) & 0x3F));
+			bytes[n++] = (char)(0x80 | (c & 0x3F));
+		}
+		else
+		{
+			bytes[n++] = (char)(0xF0 | (c >> 18));
+			bytes[n++] = (char)(0x80 | ((c >> 12) & 0x3F));
+			bytes[n++] = (char)(0x80 | ((c >> 6) & 0x3F));
+			bytes[n++] = (char)(0x80 | (c & 0x3F));
+		}
+	}
+
+	return n;
+}
+
+// Writes a string as UTF-16 characters (or UTF-8 bytes if 'utf8' is true).  If a callback is given, the text is streamed to it in chunks and
+// the number of characters (or bytes) written is returned; otherwise, as much of the text as fits is copied into 'buffer' ('capacity' is in
+// the same units), and the full length of the text is returned (so the caller can tell if the buffer was too small).
+static int32_t _WriteText(Isolate* isolate, Local<String> str, bool utf8, void* buffer, int32_t capacity, ManagedWriteCallback callback)
+{
+	auto length = str->Length();
+
+	if (callback == nullptr)
+	{
+		if (!utf8)
+		{
+			if (buffer != nullptr && capacity > 0)
+				str->Write(isolate, (uint16_t*)buffer, 0, length < capacity ? length : capacity, String::NO_NULL_TERMINATION);
+			return length;
+		}
+		else
+		{
+			if (buffer != nullptr && capacity > 0)
+				str->WriteUtf8(isolate, (char*)buffer, capacity, nullptr, String::NO_NULL_TERMINATION | String::REPLACE_INVALID_UTF8);
+			return str->Utf8Length(isolate);
+		}
+	}
+
+	const int32_t chunkSize = 1024;
+	uint16_t chars[chunkSize];
+	char bytes[chunkSize * 3];
+	int32_t written = 0;
+
+	for (int32_t pos = 0; pos < length;)
+	{
+		auto count = length - pos < chunkSize ? length - pos : chunkSize;
+		str->Write(isolate, chars, pos, count, String::NO_NULL_TERMINATION);
+
+		if (utf8 && pos + count < length && chars[count - 1] >= 0xD800 && chars[count - 1] <= 0xDBFF)
+			count--; // (don't split a surrogate pair across chunks; the high surrogate is read again with the next chunk)
+
+		pos += count;
+
+		if (!utf8)
+		{
+			written += count;
+			if (!callback(chars, count)) break;
+		}
+		else
+		{
+			auto n = _EncodeUtf8(chars, count, bytes);
+			written += n;
+			if (!callback(bytes, n)) break;
+		}
+	}
+
+	return written;
+}
 
 // ############################################################################################################################
 // DLL Exports
@@ -11,6 +106,23 @@
 // Prevent name mangling for the interface functions. 
 extern "C"
 {
+	// ------------------------------------------------------------------------------------------------------------------------
+	// Platform
+
+	// Sets the options for the V8 platform shared by all engines (see 'ProxyPlatform').  This must be called before the first engine is
+	// created; returns false if the platform already exists (the options are then ignored).
+	EXPORT bool STDCALL ConfigurePlatform(PlatformOptions *options)
+	{
+		if (options == nullptr) return false;
+		return ProxyPlatform::Configure(*options);
+	}
+
+	EXPORT void STDCALL GetPlatformStats(PlatformStats *stats)
+	{
+		if (stats != nullptr)
+			ProxyPlatform::GetStats(*stats);
+	}
+
 	// ------------------------------------------------------------------------------------------------------------------------
 	// Engine Related
 
@@ -18,11 +130,30 @@ extern "C"
 	{
 		return new V8EngineProxy(enableDebugging, debugMessageDispatcher, debugPort);
 	}
+	// Same as 'CreateV8EngineProxy()', but with engine creation flags (see 'EngineFlags').  Thread-affine engines must only be used (and
+	// destroyed) by the calling thread.
+	EXPORT V8EngineProxy* STDCALL CreateV8EngineProxyEx(bool enableDebugging, DebugMessageDispatcher *debugMessageDispatcher, int debugPort, EngineFlags flags)
+	{
+		return new V8EngineProxy(enableDebugging, debugMessageDispatcher, debugPort, flags);
+	}
 	EXPORT void STDCALL DestroyV8EngineProxy(V8EngineProxy *engine) // TODO: Consider NOT using pointers here - instead, use the ID of the engine!
 	{
 		delete engine;
 	}
 
+	// Keeps the isolate locked and the scopes entered across the following calls from the calling thread, until 'EndSession()' is called
+	// (see 'EngineSession').  Returns the session depth (sessions can be nested), or -1 if the engine is thread-affine and the calling thread
+	// is not its owner.
+	EXPORT int32_t STDCALL BeginSession(V8EngineProxy *engine)
+	{
+		return engine->BeginSession();
+	}
+	// Closes the session opened by the last 'BeginSession()' call.  Returns the remaining depth, or -1 if the calling thread has no session.
+	EXPORT int32_t STDCALL EndSession(V8EngineProxy *engine)
+	{
+		return engine->EndSession();
+	}
+
 	EXPORT ContextProxy* STDCALL CreateContext(V8EngineProxy *engine, ObjectTemplateProxy *templatePoxy) // TODO: Consider NOT using pointers here - instead, use the ID of the engine!
 	{
 		BEGIN_ISOLATE_SCOPE(engine);
@@ -129,6 +260,12 @@ extern "C"
 		engine->TerminateExecution();
 	}
 
+	// Gets the argument buffer counters (see 'ArgumentBufferStats').
+	EXPORT void STDCALL GetArgumentBufferStats(V8EngineProxy *engine, ArgumentBufferStats *stats)
+	{
+		*stats = engine->GetArgumentArena().Stats;
+	}
+
 	// ------------------------------------------------------------------------------------------------------------------------
 	// Object Template Related
 
@@ -142,8 +279,11 @@ extern "C"
 	{
 		auto engine = proxy->EngineProxy();
 		if (engine == nullptr) return false; // (might have been destroyed)
-		if (engine->IsExecutingScript())
-			return false; // TODO: Consider queuing this also.
+		if (engine->IsExecutingScript() || !engine->IsOwnerThread() || engine->InOtherThreadSession())
+		{
+			engine->QueueTemplateDeletion(proxy); // (the managed GC may never run on a thread that can use the engine, so this cannot be retried)
+			return true;
+		}
 		BEGIN_ISOLATE_SCOPE(engine);
 		delete proxy;
 		END_ISOLATE_SCOPE;
@@ -241,7 +381,7 @@ extern "C"
 					obj->SetAlignedPointerInInternalField(0, templateProxy); // (stored a reference to the proxy instance for the call-back function(s))
 				obj->SetInternalField(1, NewExternal((void*)(int64_t)managedObjectID));
 			}
-			engine->SetObjectPrivateValue(obj, "ManagedObjectID", NewInteger(managedObjectID)); // (won't be used on template created objects [fields are faster], but done anyhow for consistency)
+			engine->SetObjectPrivateValue(obj, PK_ManagedObjectID, NewInteger(managedObjectID)); // (won't be used on template created objects [fields are faster], but done anyhow for consistency)
 		}
 		handleProxy->SetManagedObjectID(managedObjectID);
 
@@ -249,6 +389,19 @@ extern "C"
 		END_ISOLATE_SCOPE;
 	}
 
+	// Tags an object as representing a strongly typed CLR value, so the type can be detected natively without any property lookups.
+	EXPORT bool STDCALL SetObjectCLRTypeID(HandleProxy *handleProxy, int32_t typeID)
+	{
+		auto engine = handleProxy->EngineProxy();
+		if (engine == nullptr) return false; // (might have been destroyed)
+
+		BEGIN_ISOLATE_SCOPE(engine);
+		BEGIN_CONTEXT_SCOPE(engine);
+		return handleProxy->SetCLRTypeID(typeID);
+		END_CONTEXT_SCOPE;
+		END_ISOLATE_SCOPE;
+	}
+
 	EXPORT HandleProxy* STDCALL GetObjectPrototype(HandleProxy *handleProxy)
 	{
 		auto engine = handleProxy->EngineProxy();
@@ -380,6 +533,156 @@ extern "C"
 		END_ISOLATE_SCOPE;
 	}
 
+	// Reads a number of properties at once into 'values' (which must have room for 'count' items).  Returns null on success, or an error handle if
+	// a name is null or a property getter threw an exception (the remaining values are set to undefined).  Strings in 'values' must be freed using 'FreePrimitiveValues()'.
+	EXPORT HandleProxy* STDCALL GetObjectProperties(HandleProxy *proxy, const uint16_t **names, int32_t count, PrimitiveValue *values)
+	{
+		auto engine = proxy->EngineProxy();
+		if (engine == nullptr) return nullptr; // (might have been destroyed)
+		BEGIN_ISOLATE_SCOPE(engine);
+		BEGIN_CONTEXT_SCOPE(engine);
+
+		auto handle = proxy->Handle();
+		if (handle.IsEmpty() || !handle->IsObject())
+			throw exception("The handle does not represent an object.");
+		auto obj = handle.As<Object>();
+		auto ctx = engine->Context();
+
+		TryCatch __tryCatch(engine->Isolate());
+
+		for (auto i = 0; i < count; i++)
+		{
+			Local<Value> value;
+			if (names[i] == nullptr)
+			{
+				for (auto j = i; j < count; j++)
+					engine->GetPrimitiveValue(Local<Value>(), values[j]);
+				return engine->CreateError("GetObjectProperties(): A property name is null.", JSV_ExecutionError);
+			}
+			if (!obj->Get(ctx, NewInternalizedUString(names[i])).ToLocal(&value) || __tryCatch.HasCaught())
+			{
+				for (auto j = i; j < count; j++)
+					engine->GetPrimitiveValue(Local<Value>(), values[j]);
+				return engine->GetErrorHandleProxy(__tryCatch, JSV_ExecutionError);
+			}
+			engine->GetPrimitiveValue(value, values[i]);
+		}
+
+		return nullptr;
+
+		END_CONTEXT_SCOPE;
+		END_ISOLATE_SCOPE;
+	}
+
+	// Reads numeric elements of an array (or typed array) into 'buffer', starting at element 'start'.  Elements that are not numbers are read
+	// as NaN.  Returns the number of elements read, or -1 if the handle is not an array or typed array.
+	EXPORT int32_t STDCALL ReadArrayNumbers(HandleProxy *proxy, int32_t start, double *buffer, int32_t count)
+	{
+		auto engine = proxy->EngineProxy();
+		if (engine == nullptr) return -1; // (might have been destroyed)
+		BEGIN_ISOLATE_SCOPE(engine);
+		BEGIN_CONTEXT_SCOPE(engine);
+		return engine->ReadArray(proxy->Handle(), start, buffer, count);
+		END_CONTEXT_SCOPE;
+		END_ISOLATE_SCOPE;
+	}
+
+	// Same as 'ReadArrayNumbers()', but elements are read as 32-bit integers (non-numbers are read as 0).
+	EXPORT int32_t STDCALL ReadArrayIntegers(HandleProxy *proxy, int32_t start, int32_t *buffer, int32_t count)
+	{
+		auto engine = proxy->EngineProxy();
+		if (engine == nullptr) return -1; // (might have been destroyed)
+		BEGIN_ISOLATE_SCOPE(engine);
+		BEGIN_CONTEXT_SCOPE(engine);
+		return engine->ReadArray(proxy->Handle(), start, buffer, count);
+		END_CONTEXT_SCOPE;
+		END_ISOLATE_SCOPE;
+	}
+
+	// Reads a range of array elements at once (the same as 'GetObjectProperties()', but by index).  Elements past the end of the array are
+	// read as undefined.  Returns null on success, or an error handle if an element getter threw an exception.
+	EXPORT HandleProxy* STDCALL GetArrayValues(HandleProxy *proxy, int32_t start, int32_t count, PrimitiveValue *values)
+	{
+		auto engine = proxy->EngineProxy();
+		if (engine == nullptr) return nullptr; // (might have been destroyed)
+		BEGIN_ISOLATE_SCOPE(engine);
+		BEGIN_CONTEXT_SCOPE(engine);
+
+		auto handle = proxy->Handle();
+		if (handle.IsEmpty() || !handle->IsObject())
+			throw exception("The handle does not represent an object.");
+		auto obj = handle.As<Object>();
+		auto ctx = engine->Context();
+
+		TryCatch __tryCatch(engine->Isolate());
+
+		for (auto i = 0; i < count; i++)
+		{
+			Local<Value> value;
+			if (!obj->Get(ctx, (uint32_t)(start + i)).ToLocal(&value) || __tryCatch.HasCaught())
+			{
+				for (auto j = i; j < count; j++)
+					engine->GetPrimitiveValue(Local<Value>(), values[j]);
+				return engine->GetErrorHandleProxy(__tryCatch, JSV_ExecutionError);
+			}
+			engine->GetPrimitiveValue(value, values[i]);
+		}
+
+		return nullptr;
+
+		END_CONTEXT_SCOPE;
+		END_ISOLATE_SCOPE;
+	}
+
+	// Sets a number of properties at once.  The properties are defined as own data properties (using 'DefineOwnProperty()', so setters are not
+	// called).  Returns null on success, or an error handle if a name is null or a property could not be defined, such as when the object is
+	// frozen or a proxy trap throws (any remaining properties are not set).
+	EXPORT HandleProxy* STDCALL SetObjectProperties(HandleProxy *proxy, const uint16_t **names, PrimitiveValue *values, int32_t count, v8::PropertyAttribute attribs = v8::None)
+	{
+		auto engine = proxy->EngineProxy();
+		if (engine == nullptr) return nullptr; // (might have been destroyed)
+		BEGIN_ISOLATE_SCOPE(engine);
+		BEGIN_CONTEXT_SCOPE(engine);
+
+		auto handle = proxy->Handle();
+		if (handle.IsEmpty() || !handle->IsObject())
+			throw exception("The handle does not represent an object.");
+		auto obj = handle.As<Object>();
+		auto ctx = engine->Context();
+
+		TryCatch __tryCatch(engine->Isolate());
+
+		for (auto i = 0; i < count; i++)
+		{
+			auto value = engine->GetValue(values[i]);
+			if (names[i] == nullptr)
+			{
+				for (auto j = i + 1; j < count; j++)
+					engine->GetValue(values[j]); // (any handles passed in must still be released)
+				return engine->CreateError("SetObjectProperties(): A property name is null.", JSV_ExecutionError);
+			}
+			if (obj->DefineOwnProperty(ctx, NewInternalizedUString(names[i]), value, attribs).IsNothing() || __tryCatch.HasCaught())
+			{
+				for (auto j = i + 1; j < count; j++)
+					engine->GetValue(values[j]); // (any handles passed in must still be released)
+				return engine->GetErrorHandleProxy(__tryCatch, JSV_ExecutionError);
+			}
+		}
+
+		return nullptr;
+
+		END_CONTEXT_SCOPE;
+		END_ISOLATE_SCOPE;
+	}
+
+	// Frees any strings returned in an array of values (such as from 'GetObjectProperties()').  Handles are not affected.
+	EXPORT void STDCALL FreePrimitiveValues(PrimitiveValue *values, int32_t count)
+	{
+		for (auto i = 0; i < count; i++)
+			if (values[i].Type == JSV_String && values[i].V8String != nullptr)
+				FREE_MANAGED_MEM(values[i].V8String);
+	}
+
 	EXPORT bool STDCALL DeleteObjectPropertyByName(HandleProxy *proxy, const uint16_t *name)
 	{
 		auto engine = proxy->EngineProxy();
@@ -432,12 +735,9 @@ extern "C"
 
 		auto obj = handle.As<Object>();
 
-		engine->SetObjectPrivateValue(obj, "ManagedObjectID", NewInteger(managedObjectID));
+		engine->SetObjectPrivateValue(obj, PK_ManagedObjectID, NewInteger(managedObjectID));
 
-		auto accessors = NewArray(3); // [0] == ManagedObjectID, [1] == getter, [2] == setter
-		accessors->Set(0, NewInteger(managedObjectID));
-		accessors->Set(1, NewExternal(getter));
-		accessors->Set(2, NewExternal(setter));
+		auto accessors = engine->CreateManagedAccessors(managedObjectID, getter, setter);
 
 		obj->Delete(engine->Context(), NewUString(name)); //? ForceDelete()?
 		obj->SetAccessor(engine->Context(), NewUString(name), ObjectTemplateProxy::AccessorGetterCallbackProxy, ObjectTemplateProxy::AccessorSetterCallbackProxy, accessors, access, attributes);  // TODO: Check how this affects objects created from templates!
@@ -461,6 +761,85 @@ extern "C"
 		END_ISOLATE_SCOPE;
 	}
 
+	// Creates a property on objects created from the template that reads and writes memory directly, at 'offset' bytes from the object's data
+	// pointer (see 'SetObjectDataPointer()').  No managed callbacks are made.
+	EXPORT void STDCALL SetObjectTemplateDirectAccessor(ObjectTemplateProxy *proxy, const uint16_t *name, int32_t offset, DirectAccessorType type,
+		v8::PropertyAttribute attributes)
+	{
+		auto engine = proxy->EngineProxy();
+		if (engine == nullptr) return; // (might have been destroyed)
+		if (offset < 0 || offset > (std::numeric_limits<int32_t>::max() >> 4))
+			throw exception("SetObjectTemplateDirectAccessor(): The offset is out of range.");
+		if (type < DA_Boolean || type >= DA_Count)
+			throw exception("SetObjectTemplateDirectAccessor(): Invalid accessor type.");
+
+		BEGIN_ISOLATE_SCOPE(engine);
+		BEGIN_CONTEXT_SCOPE(engine);
+
+		proxy->SetDirectAccessor(name, offset, type, attributes);
+
+		END_CONTEXT_SCOPE;
+		END_ISOLATE_SCOPE;
+	}
+
+	// Sets the memory read by direct accessors for an object created from a template (see 'SetObjectTemplateDirectAccessor()').  The memory must stay
+	// valid (i.e. pinned) until it is replaced, or the object is no longer used.  Pass null to clear it.  Returns false if the object was not
+	// created from a template, or the pointer is not aligned to 2 bytes.
+	EXPORT bool STDCALL SetObjectDataPointer(HandleProxy *proxy, void *data)
+	{
+		auto engine = proxy->EngineProxy();
+		if (engine == nullptr) return false; // (might have been destroyed)
+		if (((uintptr_t)data & 1) != 0) return false; // (V8 requires aligned pointers)
+
+		BEGIN_ISOLATE_SCOPE(engine);
+		BEGIN_CONTEXT_SCOPE(engine);
+
+		auto handle = proxy->Handle();
+		if (handle.IsEmpty() || !handle->IsObject())
+			return false;
+
+		auto obj = handle.As<Object>();
+		if (obj->InternalFieldCount() <= TOF_DataPointer)
+			return false;
+
+		obj->SetAlignedPointerInInternalField(TOF_DataPointer, data);
+		return true;
+
+		END_CONTEXT_SCOPE;
+		END_ISOLATE_SCOPE;
+	}
+
+	// Removes a cached property value (see 'ManagedAccessorResultFlags') from an object created from a template, so the next read calls the managed
+	// getter again.  If 'name' is null, all cached values for the object are removed.
+	EXPORT void STDCALL InvalidatePropertyCache(HandleProxy *proxy, const uint16_t *name)
+	{
+		auto engine = proxy->EngineProxy();
+		if (engine == nullptr) return; // (might have been destroyed)
+
+		BEGIN_ISOLATE_SCOPE(engine);
+		BEGIN_CONTEXT_SCOPE(engine);
+
+		auto handle = proxy->Handle();
+		if (handle.IsEmpty() || !handle->IsObject())
+			return;
+
+		auto cache = ObjectTemplateProxy::GetPropertyCache(engine, handle.As<Object>(), false);
+		if (cache.IsEmpty())
+			return;
+
+		if (name == nullptr || cache->Delete(engine->Context(), NewUString(name)).IsNothing())
+			cache->Clear(); // (also if the value could not be removed, so a stale one is never returned)
+
+		END_CONTEXT_SCOPE;
+		END_ISOLATE_SCOPE;
+	}
+
+	// Invalidates the cached property values of all objects (each cache is cleared the next time it is used, so this is a constant time operation).
+	EXPORT void STDCALL InvalidateAllPropertyCaches(V8EngineProxy *engine)
+	{
+		engine->InvalidatePropertyCaches();
+	}
+
 	EXPORT void STDCALL SetObjectTemplateProperty(ObjectTemplateProxy *proxy, const uint16_t *name, HandleProxy *value, v8::PropertyAttribute attributes)
 	{
 		auto engine = proxy->EngineProxy();
@@ -558,8 +937,11 @@ extern "C"
 	{
 		auto engine = proxy->EngineProxy();
 		if (engine == nullptr) return false; // (might have been destroyed)
-		if (engine->IsExecutingScript())
-			return false; // TODO: Consider queuing this also.
+		if (engine->IsExecutingScript() || !engine->IsOwnerThread() || engine->InOtherThreadSession())
+		{
+			engine->QueueTemplateDeletion(proxy); // (the managed GC may never run on a thread that can use the engine, so this cannot be retried)
+			return true;
+		}
 		BEGIN_ISOLATE_SCOPE(engine);
 		delete proxy;
 		END_ISOLATE_SCOPE;
@@ -617,6 +999,30 @@ extern "C"
 		END_ISOLATE_SCOPE;
 	}
 
+	// Sets a typed callback for functions created from the template that receives primitive argument values directly (see 'PrimitiveSignature').
+	// Calls with arguments that don't match the signature go through the managed callback as usual.  Pass null to remove the callback.
+	EXPORT void STDCALL SetFunctionTemplatePrimitiveCallback(FunctionTemplateProxy *proxy, PrimitiveSignature signature, void *callback)
+	{
+		auto engine = proxy->EngineProxy();
+		if (engine == nullptr) return; // (might have been destroyed)
+		if (signature < PS_None || signature >= PS_Count)
+			throw exception("SetFunctionTemplatePrimitiveCallback(): Invalid signature.");
+		BEGIN_ISOLATE_SCOPE(engine); // (so the callback never changes while a script on another thread is calling it)
+		proxy->SetPrimitiveCallback(signature, callback);
+		END_ISOLATE_SCOPE;
+	}
+
+	// Sets a managed callback for functions created from the template that receives a view over the call arguments (see 'CallbackArguments')
+	// instead of a handle proxy for every argument.  Pass null to use the regular managed callback again.
+	EXPORT void STDCALL SetFunctionTemplateArgsCallback(FunctionTemplateProxy *proxy, ManagedJSFunctionArgsCallback callback)
+	{
+		auto engine = proxy->EngineProxy();
+		if (engine == nullptr) return; // (might have been destroyed)
+		BEGIN_ISOLATE_SCOPE(engine); // (so the callback never changes while a script on another thread is calling it)
+		proxy->SetManagedArgsCallback(callback);
+		END_ISOLATE_SCOPE;
+	}
+
 	EXPORT void STDCALL SetFunctionTemplateProperty(FunctionTemplateProxy *proxy, const uint16_t *name, HandleProxy *value, v8::PropertyAttribute attributes)
 	{
 		auto engine = proxy->EngineProxy();
@@ -630,6 +1036,26 @@ extern "C"
 		END_ISOLATE_SCOPE;
 	}
 
+	// ------------------------------------------------------------------------------------------------------------------------
+	// Callback Arguments (only valid during the callback the view was given to; the isolate and handle scope of the call are already entered)
+
+	EXPORT HandleProxy* STDCALL GetCallbackThis(CallbackArguments *args)
+	{
+		return args->This();
+	}
+
+	// Returns a handle proxy for an argument (owned by the view; it is disposed when the callback returns), or null if the index is out of range.
+	EXPORT HandleProxy* STDCALL GetCallbackArgument(CallbackArguments *args, int32_t index)
+	{
+		return args->Argument(index);
+	}
+
+	// Reads an argument as a tagged value.  Strings must be freed using 'FreePrimitiveValues()'; handles are owned by the view.
+	EXPORT void STDCALL GetCallbackArgumentValue(CallbackArguments *args, int32_t index, PrimitiveValue *value)
+	{
+		args->GetValue(index, *value);
+	}
+
 	// ------------------------------------------------------------------------------------------------------------------------
 	// Value Creation 
 
@@ -639,7 +1065,7 @@ extern "C"
 	EXPORT HandleProxy* STDCALL CreateString(V8EngineProxy *engine, uint16_t* str) { BEGIN_ISOLATE_SCOPE(engine); BEGIN_CONTEXT_SCOPE(engine); return engine->CreateString(str); END_CONTEXT_SCOPE; END_ISOLATE_SCOPE; }
 	EXPORT HandleProxy* STDCALL CreateDate(V8EngineProxy *engine, double ms) { BEGIN_ISOLATE_SCOPE(engine); BEGIN_CONTEXT_SCOPE(engine); return engine->CreateDate(ms); END_CONTEXT_SCOPE; END_ISOLATE_SCOPE; }
 	EXPORT HandleProxy* STDCALL CreateObject(V8EngineProxy *engine, int32_t managedObjectID) { BEGIN_ISOLATE_SCOPE(engine); BEGIN_CONTEXT_SCOPE(engine); return engine->CreateObject(managedObjectID); END_CONTEXT_SCOPE; END_ISOLATE_SCOPE; }
-	EXPORT HandleProxy* STDCALL CreateArray(V8EngineProxy *engine, HandleProxy** items, uint16_t length)
+	EXPORT HandleProxy* STDCALL CreateArray(V8EngineProxy *engine, HandleProxy** items, int32_t length)
 	{
 		BEGIN_ISOLATE_SCOPE(engine);
 		BEGIN_CONTEXT_SCOPE(engine);
@@ -654,7 +1080,11 @@ extern "C"
 		END_CONTEXT_SCOPE;
 		END_ISOLATE_SCOPE;
 	}
-	EXPORT HandleProxy* STDCALL CreateStringArray(V8EngineProxy *engine, uint16_t **items, uint16_t length) { BEGIN_ISOLATE_SCOPE(engine); BEGIN_CONTEXT_SCOPE(engine); return engine->CreateArray(items, length); END_CONTEXT_SCOPE; END_ISOLATE_SCOPE; }
+	EXPORT HandleProxy* STDCALL CreateStringArray(V8EngineProxy *engine, uint16_t **items, int32_t length) { BEGIN_ISOLATE_SCOPE(engine); BEGIN_CONTEXT_SCOPE(engine); return engine->CreateArray(items, length); END_CONTEXT_SCOPE; END_ISOLATE_SCOPE; }
+	// Creates an array of strings from a string table ('lengths' can be null if the strings are null terminated).
+	EXPORT HandleProxy* STDCALL CreateArrayOfStrings(V8EngineProxy *engine, const uint16_t **strings, const int32_t *lengths, int32_t count) { BEGIN_ISOLATE_SCOPE(engine); BEGIN_CONTEXT_SCOPE(engine); return engine->CreateArray(strings, lengths, count); END_CONTEXT_SCOPE; END_ISOLATE_SCOPE; }
+	EXPORT HandleProxy* STDCALL CreateArrayOfNumbers(V8EngineProxy *engine, const double *values, int32_t length) { BEGIN_ISOLATE_SCOPE(engine); BEGIN_CONTEXT_SCOPE(engine); return engine->CreateArray(values, length); END_CONTEXT_SCOPE; END_ISOLATE_SCOPE; }
+	EXPORT HandleProxy* STDCALL CreateArrayOfIntegers(V8EngineProxy *engine, const int32_t *values, int32_t length) { BEGIN_ISOLATE_SCOPE(engine); BEGIN_CONTEXT_SCOPE(engine); return engine->CreateArray(values, length); END_CONTEXT_SCOPE; END_ISOLATE_SCOPE; }
 
 	EXPORT HandleProxy* STDCALL CreateNullValue(V8EngineProxy *engine) { BEGIN_ISOLATE_SCOPE(engine); BEGIN_CONTEXT_SCOPE(engine); return engine->CreateNullValue(); END_CONTEXT_SCOPE; END_ISOLATE_SCOPE; }
 
@@ -714,9 +1144,9 @@ extern "C"
 		{
 			auto engine = handleProxy->EngineProxy();
 			if (engine != nullptr) // (might have been destroyed)
-				if (engine->IsExecutingScript())
+				if (engine->IsExecutingScript() || !engine->IsOwnerThread() || engine->InOtherThreadSession())
 				{
-					// ... a script is running, so make it weak so the GC collects this later (if a script is running calling this will queue it up)...
+					// ... a script is running (or this is not the owner thread of a thread-affine engine, or another thread has a session open), so make it weak so the GC collects this later (if a script is running calling this will queue it up)...
 					engine->QueueHandleDisposal(handleProxy); // TODO: Create a queue for disposing handles as well.
 				}
 				else
@@ -743,6 +1173,20 @@ extern "C"
 			END_ISOLATE_SCOPE;
 		}
 	}
+	// Same as 'UpdateHandleValue()', but also renders the text of dates and objects (which 'UpdateHandleValue()' skips).
+	EXPORT void STDCALL UpdateHandleValueText(HandleProxy *handleProxy)
+	{
+		if (handleProxy != nullptr)
+		{
+			auto engine = handleProxy->EngineProxy();
+			if (engine == nullptr) return; // (might have been destroyed)
+			BEGIN_ISOLATE_SCOPE(engine);
+			BEGIN_CONTEXT_SCOPE(engine);
+			handleProxy->UpdateValueText();
+			END_CONTEXT_SCOPE;
+			END_ISOLATE_SCOPE;
+		}
+	}
 	EXPORT int STDCALL GetHandleManagedObjectID(HandleProxy *handleProxy)
 	{
 		if (handleProxy != nullptr)
@@ -757,6 +1201,434 @@ extern "C"
 		}
 		else return -2;
 	}
+	EXPORT int32_t STDCALL GetStringLength(HandleProxy *handleProxy)
+	{
+		if (handleProxy != nullptr)
+		{
+			auto engine = handleProxy->EngineProxy();
+			if (engine == nullptr) return -1; // (might have been destroyed)
+			BEGIN_ISOLATE_SCOPE(engine);
+			BEGIN_CONTEXT_SCOPE(engine);
+			return handleProxy->GetStringLength();
+			END_CONTEXT_SCOPE;
+			END_ISOLATE_SCOPE;
+		}
+		else return -1;
+	}
+	EXPORT int32_t STDCALL ReadString(HandleProxy *handleProxy, uint16_t* buffer, int32_t start, int32_t length)
+	{
+		if (handleProxy != nullptr)
+		{
+			auto engine = handleProxy->EngineProxy();
+			if (engine == nullptr) return -1; // (might have been destroyed)
+			BEGIN_ISOLATE_SCOPE(engine);
+			BEGIN_CONTEXT_SCOPE(engine);
+			return handleProxy->ReadString(buffer, start, length);
+			END_CONTEXT_SCOPE;
+			END_ISOLATE_SCOPE;
+		}
+		else return -1;
+	}
+	// Gets the line and column of a script error.  Returns false if the handle is not a script error, or has no location details.
+	EXPORT bool STDCALL GetErrorLocation(HandleProxy *handleProxy, int32_t *line, int32_t *column)
+	{
+		if (handleProxy != nullptr && handleProxy->GetScriptError() != nullptr)
+		{
+			auto engine = handleProxy->EngineProxy();
+			if (engine == nullptr) return false; // (might have been destroyed)
+			BEGIN_ISOLATE_SCOPE(engine);
+			BEGIN_CONTEXT_SCOPE(engine);
+			auto error = handleProxy->GetScriptError();
+			if (!error->HasMessage()) return false;
+			if (line != nullptr) *line = error->LineNumber();
+			if (column != nullptr) *column = error->StartColumn();
+			return true;
+			END_CONTEXT_SCOPE;
+			END_ISOLATE_SCOPE;
+		}
+		else return false;
+	}
+	// Gets part of a script error as a new handle (see 'ScriptErrorField').  Returns null if the handle is not a script error, or the part is not available.
+	EXPORT HandleProxy* STDCALL GetErrorField(HandleProxy *handleProxy, ScriptErrorField field)
+	{
+		if (handleProxy != nullptr && handleProxy->GetScriptError() != nullptr)
+		{
+			auto engine = handleProxy->EngineProxy();
+			if (engine == nullptr) return nullptr; // (might have been destroyed)
+			BEGIN_ISOLATE_SCOPE(engine);
+			BEGIN_CONTEXT_SCOPE(engine);
+			auto value = handleProxy->GetScriptError()->GetField(field);
+			return value.IsEmpty() ? nullptr : engine->GetHandleProxy(value);
+			END_CONTEXT_SCOPE;
+			END_ISOLATE_SCOPE;
+		}
+		else return nullptr;
+	}
+
+	// ------------------------------------------------------------------------------------------------------------------------
+	// Object Shapes
+
+	// Registers an object shape (an ordered list of property names and their expected types) and returns its ID (see 'ObjectShape').
+	EXPORT int32_t STDCALL RegisterShape(V8EngineProxy *engine, const uint16_t **names, const ShapeFieldType *types, int32_t count)
+	{
+		BEGIN_ISOLATE_SCOPE(engine);
+		BEGIN_CONTEXT_SCOPE(engine);
+		return engine->RegisterShape(names, types, count);
+		END_CONTEXT_SCOPE;
+		END_ISOLATE_SCOPE;
+	}
+
+	// Reads the properties of a shape from an object into a packed struct ('bufferSize' must be at least the size of the shape).
+	// Returns null on success, or an error handle.  'mismatches' receives the number of properties that didn't have the expected type.
+	// Note: Strings in the struct must be freed using 'FreeShapeValues()'.
+	EXPORT HandleProxy* STDCALL ExtractShape(HandleProxy *proxy, int32_t shapeID, byte *buffer, int32_t bufferSize, int32_t *mismatches)
+	{
+		if (mismatches != nullptr) *mismatches = 0;
+		auto engine = proxy->EngineProxy();
+		if (engine == nullptr) return nullptr; // (might have been destroyed)
+		BEGIN_ISOLATE_SCOPE(engine);
+		BEGIN_CONTEXT_SCOPE(engine);
+
+		auto shape = engine->GetShape(shapeID);
+		if (shape == nullptr)
+			return engine->CreateError("ExtractShape(): Invalid shape ID.", JSV_InternalError);
+		if (buffer == nullptr || bufferSize < shape->Size())
+			return engine->CreateError("ExtractShape(): The buffer is too small for the shape.", JSV_InternalError);
+
+		auto handle = proxy->Handle();
+		if (handle.IsEmpty() || !handle->IsObject())
+			throw exception("The handle does not represent an object.");
+
+		TryCatch __tryCatch(engine->Isolate());
+
+		auto result = shape->Extract(handle.As<Object>(), buffer);
+		if (result < 0 || __tryCatch.HasCaught())
+			return engine->GetErrorHandleProxy(__tryCatch, JSV_ExecutionError);
+
+		if (mismatches != nullptr) *mismatches = result;
+		return nullptr;
+
+		END_CONTEXT_SCOPE;
+		END_ISOLATE_SCOPE;
+	}
+
+	// Creates an object from a packed struct using the pre-built template of a shape.
+	EXPORT HandleProxy* STDCALL CreateFromShape(V8EngineProxy *engine, int32_t shapeID, const byte *buffer)
+	{
+		BEGIN_ISOLATE_SCOPE(engine);
+		BEGIN_CONTEXT_SCOPE(engine);
+
+		auto shape = engine->GetShape(shapeID);
+		if (shape == nullptr)
+			return engine->CreateError("CreateFromShape(): Invalid shape ID.", JSV_InternalError);
+		if (buffer == nullptr)
+			return engine->CreateError("CreateFromShape(): No buffer was given.", JSV_InternalError);
+
+		TryCatch __tryCatch(engine->Isolate());
+
+		Local<Object> obj;
+		if (!shape->Create(buffer).ToLocal(&obj) || __tryCatch.HasCaught())
+		{
+			if (__tryCatch.HasCaught())
+				return engine->GetErrorHandleProxy(__tryCatch, JSV_ExecutionError);
+			return engine->CreateError("CreateFromShape(): The object could not be created.", JSV_InternalError);
+		}
+
+		return engine->GetHandleProxy(obj);
+
+		END_CONTEXT_SCOPE;
+		END_ISOLATE_SCOPE;
+	}
+
+	// Frees any strings in a packed struct filled in by 'ExtractShape()'.
+	EXPORT void STDCALL FreeShapeValues(V8EngineProxy *engine, int32_t shapeID, byte *buffer)
+	{
+		auto shape = engine->GetShape(shapeID);
+		if (shape != nullptr && buffer != nullptr)
+			shape->FreeValues(buffer);
+	}
+
+	// ------------------------------------------------------------------------------------------------------------------------
+	// Datasets
+
+	// Creates a dataset object over columnar memory owned by the managed side (see 'Dataset').  'releaseCallback' is called with 'releaseID' once
+	// V8 no longer references the dataset (or when the engine is disposed), but not if an error handle is returned.
+	EXPORT HandleProxy* STDCALL CreateDataset(V8EngineProxy *engine, int32_t rowCount, const DatasetColumnInfo *columns, int32_t columnCount,
+		ManagedReleaseCallback releaseCallback, int32_t releaseID)
+	{
+		BEGIN_ISOLATE_SCOPE(engine);
+		BEGIN_CONTEXT_SCOPE(engine);
+		return engine->CreateDataset(rowCount, columns, columnCount, releaseCallback, releaseID);
+		END_CONTEXT_SCOPE;
+		END_ISOLATE_SCOPE;
+	}
+
+	// ------------------------------------------------------------------------------------------------------------------------
+	// Array Buffers
+
+	// Creates an array buffer over memory owned by the caller (no copy is made).  'releaseCallback' (if given) is called with 'releaseID' once
+	// V8 no longer references the buffer (or when the engine is disposed); until then the memory must remain valid and must not move.
+	EXPORT HandleProxy* STDCALL CreateExternalArrayBuffer(V8EngineProxy *engine, void* data, int64_t length, ManagedReleaseCallback releaseCallback, int32_t releaseID)
+	{
+		BEGIN_ISOLATE_SCOPE(engine);
+		BEGIN_CONTEXT_SCOPE(engine);
+		return engine->CreateExternalArrayBuffer(data, length, releaseCallback, releaseID);
+		END_CONTEXT_SCOPE;
+		END_ISOLATE_SCOPE;
+	}
+
+	// Creates a typed array (or data view) over an array buffer, or over the buffer of an existing view (the byte offset is then relative to
+	// that view, and the new view must fit within it).  'length' is the number of elements (bytes for data views), or -1 to use the rest of
+	// the buffer (or existing view).
+	EXPORT HandleProxy* STDCALL CreateTypedArray(HandleProxy *buffer, TypedArrayType type, int64_t byteOffset, int64_t length)
+	{
+		auto engine = buffer->EngineProxy();
+		if (engine == nullptr) return nullptr; // (might have been destroyed)
+		BEGIN_ISOLATE_SCOPE(engine);
+		BEGIN_CONTEXT_SCOPE(engine);
+
+		auto h = buffer->Handle();
+
+		if (h->IsArrayBuffer())
+			return engine->CreateTypedArray(h.As<ArrayBuffer>(), type, byteOffset, length);
+
+		if (h->IsArrayBufferView())
+		{
+			auto view = h.As<ArrayBufferView>();
+			return engine->CreateTypedArray(view->Buffer(), type, byteOffset, length, (int64_t)view->ByteOffset(), (int64_t)view->ByteLength());
+		}
+
+		return engine->CreateError("CreateTypedArray(): The handle is not an array buffer or view.", JSV_InternalError);
+
+		END_CONTEXT_SCOPE;
+		END_ISOLATE_SCOPE;
+	}
+
+	// Gets the backing store memory of an array buffer, or the part of it that a typed array or data view covers.  Returns false if the handle is
+	// not an array buffer or view.
+	// Note: The memory is only valid while the buffer is referenced, and (for buffers not created over external memory) is owned by V8.
+	EXPORT bool STDCALL GetArrayBufferContents(HandleProxy *proxy, void** data, int64_t* length)
+	{
+		if (data != nullptr) *data = nullptr;
+		if (length != nullptr) *length = 0;
+		auto engine = proxy->EngineProxy();
+		if (engine == nullptr) return false; // (might have been destroyed)
+		BEGIN_ISOLATE_SCOPE(engine);
+		BEGIN_CONTEXT_SCOPE(engine);
+
+		auto h = proxy->Handle();
+		byte* start;
+		size_t size;
+
+		if (h->IsArrayBuffer())
+		{
+			auto contents = h.As<ArrayBuffer>()->GetContents();
+			start = (byte*)contents.Data();
+			size = contents.ByteLength();
+		}
+		else if (h->IsArrayBufferView())
+		{
+			auto view = h.As<ArrayBufferView>();
+			auto contents = view->Buffer()->GetContents();
+			start = (byte*)contents.Data() + view->ByteOffset();
+			size = view->ByteLength();
+		}
+		else return false;
+
+		if (data != nullptr) *data = start;
+		if (length != nullptr) *length = (int64_t)size;
+
+		return true;
+
+		END_CONTEXT_SCOPE;
+		END_ISOLATE_SCOPE;
+	}
+
+	// Sets the limit on the bytes the engine can allocate for array buffers (0 for no limit; scripts get a 'RangeError' when it is reached), and
+	// the limit on the bytes of freed blocks kept for reuse (0 disables pooling).  Buffers over external memory don't count towards the limit.
+	EXPORT void STDCALL SetArrayBufferLimits(V8EngineProxy *engine, int64_t maxBytes, int64_t maxPooledBytes)
+	{
+		engine->ArrayBufferAllocator()->SetLimits(maxBytes, maxPooledBytes);
+	}
+
+	EXPORT void STDCALL GetArrayBufferAllocatorStats(V8EngineProxy *engine, ArrayBufferAllocatorStats *stats)
+	{
+		if (stats != nullptr)
+			engine->ArrayBufferAllocator()->GetStats(*stats);
+	}
+
+	// ------------------------------------------------------------------------------------------------------------------------
+	// JSON
+
+	// Parses JSON text (UTF-16) using the native V8 parser.  If 'length' is negative, the text must be null terminated.
+	// Returns the value, or an error handle of type 'JSV_ExecutionError' if the text is not valid JSON.
+	EXPORT HandleProxy* STDCALL ParseJSON(V8EngineProxy *engine, const uint16_t* json, int32_t length)
+	{
+		BEGIN_ISOLATE_SCOPE(engine);
+		BEGIN_CONTEXT_SCOPE(engine);
+
+		TryCatch __tryCatch(engine->Isolate());
+		Local<String> str;
+		Local<Value> value;
+
+		if (!String::NewFromTwoByte(engine->Isolate(), json != nullptr ? json : (const uint16_t*)L"", NewStringType::kNormal, length).ToLocal(&str))
+			return engine->CreateError("ParseJSON(): The JSON text is too long.", JSV_InternalError);
+
+		if (!JSON::Parse(engine->Context(), str).ToLocal(&value))
+			return engine->GetErrorHandleProxy(__tryCatch, JSV_ExecutionError);
+
+		return engine->GetHandleProxy(value);
+
+		END_CONTEXT_SCOPE;
+		END_ISOLATE_SCOPE;
+	}
+
+	// Parses JSON text (UTF-8) using the native V8 parser.  If 'length' is negative, the text must be null terminated.
+	// Returns the value, or an error handle of type 'JSV_ExecutionError' if the text is not valid JSON.
+	EXPORT HandleProxy* STDCALL ParseJSONUtf8(V8EngineProxy *engine, const char* json, int32_t length)
+	{
+		BEGIN_ISOLATE_SCOPE(engine);
+		BEGIN_CONTEXT_SCOPE(engine);
+
+		TryCatch __tryCatch(engine->Isolate());
+		Local<String> str;
+		Local<Value> value;
+
+		if (!String::NewFromUtf8(engine->Isolate(), json != nullptr ? json : "", NewStringType::kNormal, length).ToLocal(&str))
+			return engine->CreateError("ParseJSONUtf8(): The JSON text is too long.", JSV_InternalError);
+
+		if (!JSON::Parse(engine->Context(), str).ToLocal(&value))
+			return engine->GetErrorHandleProxy(__tryCatch, JSV_ExecutionError);
+
+		return engine->GetHandleProxy(value);
+
+		END_CONTEXT_SCOPE;
+		END_ISOLATE_SCOPE;
+	}
+
+	// Converts a value to JSON text using the native V8 serializer ('gap' is the optional indent string, as in 'JSON.stringify()').
+	// The text is written as UTF-16 characters, or as UTF-8 bytes if 'utf8' is true.  If a callback is given, the text is streamed to it
+	// in chunks and 'length' receives the number of characters (or bytes) written.  Otherwise, as much of the text as fits is copied into
+	// 'buffer' ('capacity' is in the same units) and 'length' receives the full length (if larger than 'capacity', call again with a
+	// larger buffer).  Returns null on success, or an error handle of type 'JSV_ExecutionError' (such as when the value has cycles).
+	EXPORT HandleProxy* STDCALL StringifyJSON(HandleProxy *proxy, const uint16_t* gap, bool utf8, void* buffer, int32_t capacity, int32_t* length, ManagedWriteCallback callback)
+	{
+		if (length != nullptr) *length = 0;
+		auto engine = proxy->EngineProxy();
+		if (engine == nullptr) return nullptr; // (might have been destroyed)
+		BEGIN_ISOLATE_SCOPE(engine);
+		BEGIN_CONTEXT_SCOPE(engine);
+
+		TryCatch __tryCatch(engine->Isolate());
+		Local<String> json;
+
+		if (!JSON::Stringify(engine->Context(), proxy->Handle(), gap != nullptr ? NewUString(gap) : Local<String>()).ToLocal(&json))
+			return engine->GetErrorHandleProxy(__tryCatch, JSV_ExecutionError);
+
+		auto count = _WriteText(engine->Isolate(), json, utf8, buffer, capacity, callback);
+		if (length != nullptr) *length = count;
+
+		return nullptr;
+
+		END_CONTEXT_SCOPE;
+		END_ISOLATE_SCOPE;
+	}
+
+	// ------------------------------------------------------------------------------------------------------------------------
+	// Serialization
+
+	// Serializes a value (and any objects it references) into a buffer (see 'SerializedType' for the format).  If '*buffer' is null, or is not large
+	// enough, a new buffer is allocated and returned in 'buffer' and 'capacity' (the caller must then free it using 'FreeNativeMemory()').
+	// Returns the number of bytes written, or one of the 'SerializerResult' error values (in which case 'buffer' and 'capacity' are not changed).
+	EXPORT int32_t STDCALL SerializeValue(HandleProxy *proxy, byte **buffer, int32_t *capacity, int32_t maxDepth, int32_t maxSize)
+	{
+		if (proxy == nullptr || buffer == nullptr || capacity == nullptr) return SR_InvalidValue;
+		auto engine = proxy->EngineProxy();
+		if (engine == nullptr) return SR_InvalidValue; // (might have been destroyed)
+		BEGIN_ISOLATE_SCOPE(engine);
+		BEGIN_CONTEXT_SCOPE(engine);
+
+		ObjectSerializer serializer(engine, *buffer, *capacity, maxDepth > 0 ? maxDepth : 100, maxSize > 0 ? maxSize : INT32_MAX);
+		auto result = serializer.Serialize(proxy->Handle());
+
+		if (serializer.Buffer() != *buffer)
+		{
+			if (result >= 0)
+			{
+				*buffer = serializer.Buffer();
+				*capacity = serializer.Capacity();
+			}
+			else
+			{
+				auto newBuffer = serializer.Buffer();
+				FREE_MANAGED_MEM(newBuffer);
+			}
+		}
+
+		return result;
+
+		END_CONTEXT_SCOPE;
+		END_ISOLATE_SCOPE;
+	}
+
+	// Builds a value (and any objects it references) from data in the 'SerializeValue()' format, all in one call.
+	// Returns the value, or an error handle of type 'JSV_InternalError' if the data is not valid or limits were exceeded.
+	EXPORT HandleProxy* STDCALL DeserializeValue(V8EngineProxy *engine, const byte *data, int32_t length, int32_t maxDepth)
+	{
+		BEGIN_ISOLATE_SCOPE(engine);
+		BEGIN_CONTEXT_SCOPE(engine);
+
+		ObjectDeserializer deserializer(engine, data, length, maxDepth > 0 ? maxDepth : 100);
+		Local<Value> value;
+
+		switch (deserializer.Deserialize(value))
+		{
+		case SR_Success: return engine->GetHandleProxy(value);
+		case SR_MaxDepthExceeded: return engine->CreateError("DeserializeValue(): The data is nested too deeply.", JSV_InternalError);
+		case SR_MaxSizeExceeded: return engine->CreateError("DeserializeValue(): A string in the data is too long.", JSV_InternalError);
+		case SR_ScriptError: return engine->CreateError("DeserializeValue(): Failed to create a value.", JSV_InternalError);
+		default: return engine->CreateError("DeserializeValue(): The data is not valid.", JSV_InternalError);
+		}
+
+		END_CONTEXT_SCOPE;
+		END_ISOLATE_SCOPE;
+	}
+
+	// Frees memory allocated on the native side for the managed side (such as buffers returned from 'SerializeValue()').
+	EXPORT void STDCALL FreeNativeMemory(void *ptr)
+	{
+		if (ptr != nullptr)
+			FREE_MANAGED_MEM(ptr);
+	}
+
+	// ------------------------------------------------------------------------------------------------------------------------
+	// Command Buffers
+
+	// Registers a property name for use in command buffers (see 'CommandOpCode') and returns its ID.
+	EXPORT int32_t STDCALL RegisterCommandName(V8EngineProxy *engine, const uint16_t *name)
+	{
+		BEGIN_ISOLATE_SCOPE(engine);
+		BEGIN_CONTEXT_SCOPE(engine);
+		return engine->RegisterCommandName(name);
+		END_CONTEXT_SCOPE;
+		END_ISOLATE_SCOPE;
+	}
+
+	// Runs the commands in a command buffer (see 'CommandOpCode') under a single scope, and writes the values read by 'CO_Read' into 'results'.
+	// Returns null on success, or an error handle.  'resultCount' receives the number of results written (even if an error occurred).
+	// Note: Strings in 'results' must be freed using 'FreePrimitiveValues()', and the handles disposed as usual.
+	EXPORT HandleProxy* STDCALL ExecuteCommandBuffer(V8EngineProxy *engine, const byte *commands, int32_t length, PrimitiveValue *results, int32_t resultCapacity, int32_t *resultCount)
+	{
+		if (resultCount != nullptr) *resultCount = 0;
+		BEGIN_ISOLATE_SCOPE(engine);
+		BEGIN_CONTEXT_SCOPE(engine);
+		CommandInterpreter interpreter(engine, commands, length, results, resultCapacity);
+		auto error = interpreter.Execute();
+		if (resultCount != nullptr) *resultCount = interpreter.ResultCount();
+		return error;
+		END_CONTEXT_SCOPE;
+		END_ISOLATE_SCOPE;
+	}
 
 	// ------------------------------------------------------------------------------------------------------------------------
 
@@ -3,7 +3,8 @@
 // ------------------------------------------------------------------------------------------------------------------------
 
 FunctionTemplateProxy::FunctionTemplateProxy(V8EngineProxy* engineProxy, uint16_t* className, ManagedJSFunctionCallback managedCallback)
-	:ProxyBase(FunctionTemplateProxyClass), _EngineProxy(engineProxy), _EngineID(engineProxy->_EngineID)
+	:ProxyBase(FunctionTemplateProxyClass), _EngineProxy(engineProxy), _EngineID(engineProxy->_EngineID), _ManagedArgsCallback(nullptr),
+	_PrimitiveSignature(PS_None), _PrimitiveCallback(nullptr)
 {
 	// The function template will call the local "InvocationCallbackProxy" function, which then translates the call for the managed side.
 	_FunctionTemplate = CopyablePersistent<FunctionTemplate>(NewFunctionTemplate(InvocationCallbackProxy, NewExternal(this)));
@@ -45,6 +46,80 @@ FunctionTemplateProxy::~FunctionTemplateProxy()
 
 void FunctionTemplateProxy::SetManagedCallback(ManagedJSFunctionCallback managedCallback) { _ManagedCallback = managedCallback; }
 
+void FunctionTemplateProxy::SetManagedArgsCallback(ManagedJSFunctionArgsCallback managedCallback) { _ManagedArgsCallback = managedCallback; }
+
+void FunctionTemplateProxy::SetPrimitiveCallback(PrimitiveSignature signature, void* callback)
+{
+	_PrimitiveCallback = nullptr; // (in case a script calls the function while the signature changes)
+	_PrimitiveSignature = callback != nullptr ? signature : PS_None;
+	_PrimitiveCallback = _PrimitiveSignature != PS_None ? callback : nullptr;
+}
+
+// ------------------------------------------------------------------------------------------------------------------------
+
+// Calls the primitive callback if the arguments match its signature.  Returns false if they don't, in which case the managed callback
+// should be used instead.
+bool FunctionTemplateProxy::_InvokePrimitiveCallback(const FunctionCallbackInfo<Value>& args)
+{
+	if (args.IsConstructCall())
+		return false;
+
+	auto argLength = args.Length();
+	double n[PRIMITIVE_CALLBACK_MAX_ARGS];
+	int32_t i[2];
+
+	// ... read the arguments (missing ones are 'undefined', which never match) ...
+
+	switch (_PrimitiveSignature)
+	{
+	case PS_Number1: case PS_Number2: case PS_NumberArray:
+	{
+		auto count = _PrimitiveSignature == PS_Number1 ? 1 : _PrimitiveSignature == PS_Number2 ? 2 : argLength;
+		if (count > PRIMITIVE_CALLBACK_MAX_ARGS)
+			return false;
+		for (auto a = 0; a < count; a++)
+		{
+			auto arg = args[a];
+			if (!arg->IsNumber()) return false;
+			n[a] = arg.As<Number>()->Value();
+		}
+		break;
+	}
+	case PS_Int32_1: case PS_Int32_2:
+	{
+		auto count = _PrimitiveSignature == PS_Int32_1 ? 1 : 2;
+		for (auto a = 0; a < count; a++)
+		{
+			auto arg = args[a];
+			if (!arg->IsInt32()) return false;
+			i[a] = arg.As<Int32>()->Value();
+		}
+		break;
+	}
+	default: return false;
+	}
+
+	// ... make the call ...
+
+	_EngineProxy->_InCallbackScope++;
+	try
+	{
+		switch (_PrimitiveSignature)
+		{
+		case PS_Number1: args.GetReturnValue().Set(((PrimitiveNumber1Callback)_PrimitiveCallback)(n[0])); break;
+		case PS_Number2: args.GetReturnValue().Set(((PrimitiveNumber2Callback)_PrimitiveCallback)(n[0], n[1])); break;
+		case PS_Int32_1: args.GetReturnValue().Set(((PrimitiveInt32_1Callback)_PrimitiveCallback)(i[0])); break;
+		case PS_Int32_2: args.GetReturnValue().Set(((PrimitiveInt32_2Callback)_PrimitiveCallback)(i[0], i[1])); break;
+		case PS_NumberArray: args.GetReturnValue().Set(((PrimitiveNumberArrayCallback)_PrimitiveCallback)(n, argLength)); break;
+		default: break;
+		}
+	}
+	catch (...) { ThrowException(NewString("'InvocationCallbackProxy' caused an error in a primitive callback - perhaps the GC collected the delegate?")); }
+	_EngineProxy->_InCallbackScope--;
+
+	return true;
+}
+
 // ------------------------------------------------------------------------------------------------------------------------
 
 void FunctionTemplateProxy::InvocationCallbackProxy(const FunctionCallbackInfo<Value>& args)
@@ -56,8 +131,18 @@ void FunctionTemplateProxy::InvocationCallbackProxy(const FunctionCallbackInfo<V
 
 	if (proxy->GetType() == FunctionTemplateProxyClass)
 	{
+		if (((FunctionTemplateProxy*)proxy)->_PrimitiveCallback != nullptr && ((FunctionTemplateProxy*)proxy)->_InvokePrimitiveCallback(args))
+			return; // (handled without creating any handle proxies)
+
 		engine = ((FunctionTemplateProxy*)proxy)->_EngineProxy;
 		callback = ((FunctionTemplateProxy*)proxy)->_ManagedCallback;
+
+		auto argsCallback = ((FunctionTemplateProxy*)proxy)->_ManagedArgsCallback;
+		if (argsCallback != nullptr)
+		{
+			_InvokeArgsCallback(engine, argsCallback, args);
+			return;
+		}
 	}
 	else if (proxy->GetType() == ObjectTemplateProxyClass)
 	{
@@ -69,7 +154,7 @@ void FunctionTemplateProxy::InvocationCallbackProxy(const FunctionCallbackInfo<V
 	if (callback != nullptr) // (note: '_ManagedCallback' may not be set on the proxy, and thus 'callback' may be null)
 	{
 		auto argLength = args.Length();
-		auto _args = argLength > 0 ? new HandleProxy*[argLength] : nullptr;
+		ArgumentBuffer<HandleProxy*> _args(engine->GetArgumentArena(), argLength);
 
 		for (auto i = 0; i < argLength; i++)
 			_args[i] = engine->GetHandleProxy(args[i]);
@@ -79,14 +164,14 @@ void FunctionTemplateProxy::InvocationCallbackProxy(const FunctionCallbackInfo<V
 		engine->_InCallbackScope++;
 		HandleProxy* result = nullptr;
 		try {
-			result = callback(0, args.IsConstructCall(), _this, _args, argLength);
+			result = callback(0, args.IsConstructCall(), _this, _args.Items(), argLength);
 		}
 		catch (...) { ThrowException(NewString("'InvocationCallbackProxy' caused an error - perhaps the GC collected the delegate?")); }
 		engine->_InCallbackScope--;
 
 		if (result != nullptr) {
 			if (result->IsError())
-				args.GetReturnValue().Set(ThrowException(Exception::Error(result->Handle()->ToString(args.GetIsolate()))));
+				args.GetReturnValue().Set(ThrowException(Exception::Error(result->GetErrorText())));
 			else
 				args.GetReturnValue().Set(result->Handle()); // (note: the returned value was created via p/invoke calls from the managed side, so the managed side is expected to tracked and free this handle when done)
 
@@ -107,6 +192,80 @@ void FunctionTemplateProxy::InvocationCallbackProxy(const FunctionCallbackInfo<V
 
 // ------------------------------------------------------------------------------------------------------------------------
 
+void FunctionTemplateProxy::_InvokeArgsCallback(V8EngineProxy* engine, ManagedJSFunctionArgsCallback callback, const FunctionCallbackInfo<Value>& args)
+{
+	CallbackArguments _args(engine, args); // (any handle proxies requested by the managed side are disposed when this goes out of scope)
+
+	engine->_InCallbackScope++;
+	HandleProxy* result = nullptr;
+	try {
+		result = callback(0, args.IsConstructCall(), &_args, _args.Length());
+	}
+	catch (...) { ThrowException(NewString("'InvocationCallbackProxy' caused an error - perhaps the GC collected the delegate?")); }
+	engine->_InCallbackScope--;
+
+	if (result != nullptr) {
+		if (result->IsError())
+			args.GetReturnValue().Set(ThrowException(Exception::Error(result->GetErrorText())));
+		else
+			args.GetReturnValue().Set(result->Handle());
+
+		result->TryDispose(); // (before the view disposes the arguments, as the result may be one of them)
+	}
+}
+
+// ------------------------------------------------------------------------------------------------------------------------
+
+CallbackArguments::CallbackArguments(V8EngineProxy* engine, const FunctionCallbackInfo<Value>& info)
+	: Engine(engine), Info(&info), _This(nullptr), _Args(engine->GetArgumentArena(), info.Length())
+{
+	for (auto i = 0, n = Length(); i < n; i++)
+		_Args[i] = nullptr;
+}
+
+CallbackArguments::~CallbackArguments()
+{
+	if (_This != nullptr)
+		_This->TryDispose();
+
+	for (auto i = 0, n = Length(); i < n; i++)
+		if (_Args[i] != nullptr)
+			_Args[i]->TryDispose();
+}
+
+HandleProxy* CallbackArguments::This()
+{
+	if (_This == nullptr)
+		_This = Engine->GetHandleProxy(Info->This());
+	return _This;
+}
+
+HandleProxy* CallbackArguments::Argument(int32_t index)
+{
+	if (index < 0 || index >= Length())
+		return nullptr;
+
+	if (_Args[index] == nullptr)
+		_Args[index] = Engine->GetHandleProxy((*Info)[index]);
+
+	return _Args[index];
+}
+
+void CallbackArguments::GetValue(int32_t index, PrimitiveValue &value)
+{
+	auto arg = (*Info)[index]; // (undefined if out of range)
+
+	if (arg->IsUndefined() || arg->IsNull() || arg->IsBoolean() || arg->IsNumber() || arg->IsString() || arg->IsDate())
+		Engine->GetPrimitiveValue(arg, value);
+	else
+	{
+		// ... reuse (or create) the argument's handle proxy, so it is disposed with the others ...
+		Engine->SetPrimitiveHandle(Argument(index), value); // (also types errors and symbols as handles, instead of undefined)
+	}
+}
+
+// ------------------------------------------------------------------------------------------------------------------------
+
 ObjectTemplateProxy* FunctionTemplateProxy::GetInstanceTemplateProxy()
 {
 	return _InstanceTemplate;
@@ -132,11 +291,10 @@ HandleProxy* FunctionTemplateProxy::GetFunction()
 
 HandleProxy* FunctionTemplateProxy::CreateInstance(int32_t managedObjectID, int32_t argCount, HandleProxy** args)
 {
-	Handle<Value>* hArgs = new Handle<Value>[argCount];
+	ArgumentBuffer<Local<Value>> hArgs(_EngineProxy->GetArgumentArena(), argCount);
 	for (int i = 0; i < argCount; i++)
 		hArgs[i] = args[i]->Handle();
-	auto obj = _FunctionTemplate->GetFunction(_EngineProxy->Context()).ToLocalChecked()->NewInstance(_EngineProxy->Context(), argCount, hArgs).ToLocalChecked();
-	delete[] hArgs; // TODO: (does "disposed" still need to be called here for each item?)
+	auto obj = _FunctionTemplate->GetFunction(_EngineProxy->Context()).ToLocalChecked()->NewInstance(_EngineProxy->Context(), argCount, hArgs.Items()).ToLocalChecked();
 
 	if (managedObjectID == -1)
 		managedObjectID = _EngineProxy->GetNextNonTemplateObjectID();
@@ -146,7 +304,7 @@ HandleProxy* FunctionTemplateProxy::CreateInstance(int32_t managedObjectID, int3
 	//??auto count = obj->InternalFieldCount();
 	obj->SetAlignedPointerInInternalField(0, this); // (stored a reference to the proxy instance for the call-back functions)
 	obj->SetInternalField(1, NewExternal((void*)(int64_t)managedObjectID)); // (stored a reference to the managed object for the call-back functions)
-	obj->SetPrivate(_EngineProxy->Context(), NewPrivateString("ManagedObjectID"), NewInteger(managedObjectID)); // (won't be used on template created objects [fields are faster], but done anyhow for consistency)
+	_EngineProxy->SetObjectPrivateValue(obj, PK_ManagedObjectID, NewInteger(managedObjectID)); // (won't be used on template created objects [fields are faster], but done anyhow for consistency)
 	return proxyVal;
 }
 
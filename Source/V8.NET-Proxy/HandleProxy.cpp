@@ -8,7 +8,8 @@ v8::Local<Script> HandleProxy::Script() { return _Script; }
 // ------------------------------------------------------------------------------------------------------------------------
 
 HandleProxy::HandleProxy(V8EngineProxy* engineProxy, int32_t id)
-	: ProxyBase(HandleProxyClass), _Type((JSValueType)-1), _ID(id), _ManagedReference(0), _ObjectID(-1), _CLRTypeID(-1), __EngineProxy(0), _Disposed(0)
+	: ProxyBase(HandleProxyClass), _ID(id), _ObjectID(-1), _CLRTypeID(-1), _Type((JSValueType)-1), _ManagedReference(0), _Disposed(0), _ValueIsCurrent(0), _Generation(0),
+	__EngineProxy(0), _Error(nullptr)
 {
 	_EngineProxy = engineProxy;
 	_EngineID = _EngineProxy->_EngineID;
@@ -52,6 +53,7 @@ bool HandleProxy::_Dispose(bool registerDisposal)
 			}
 
 			_Disposed = 3; // (just to be consistent)
+			_Generation++; // (the ID can now be reused for another value)
 
 			_ClearHandleValue();
 
@@ -106,7 +108,13 @@ void HandleProxy::_ClearHandleValue()
 	{
 		_Script.Reset();
 	}
+	if (_Error != nullptr)
+	{
+		delete _Error;
+		_Error = nullptr;
+	}
 	_Value.Dispose();
+	_ValueIsCurrent = 0;
 	_Type = JSV_Uninitialized;
 	if (_Handle.IsWeak())
 		throw exception("HandleProxy::_ClearHandleValue(): Assertion failed - tried to clear a handle that is still in a weak state.");
@@ -128,13 +136,18 @@ HandleProxy* HandleProxy::SetHandle(v8::Handle<Value> handle)
 
 	_Handle = CopyablePersistent<Value>(handle);
 
+	// (note: the values of primitive types are read now [the isolate is already entered], so the managed side doesn't need to call back for them)
+
 	if (_Handle.IsEmpty())
 	{
 		_Type = JSV_Undefined;
+		_ValueIsCurrent = 1;
 	}
 	else if (_Handle->IsBoolean())
 	{
 		_Type = JSV_Bool;
+		_Value.V8Boolean = handle->IsTrue();
+		_ValueIsCurrent = 1;
 	}
 	else if (_Handle->IsBooleanObject()) // TODO: Validate this is correct.
 	{
@@ -144,10 +157,14 @@ HandleProxy* HandleProxy::SetHandle(v8::Handle<Value> handle)
 	else if (_Handle->IsInt32())
 	{
 		_Type = JSV_Int32;
+		_Value.V8Integer = handle.As<Int32>()->Value();
+		_ValueIsCurrent = 1;
 	}
 	else if (_Handle->IsNumber())
 	{
 		_Type = JSV_Number;
+		_Value.V8Number = handle.As<Number>()->Value();
+		_ValueIsCurrent = 1;
 	}
 	else if (_Handle->IsNumberObject()) // TODO: Validate this is correct.
 	{
@@ -181,6 +198,7 @@ HandleProxy* HandleProxy::SetHandle(v8::Handle<Value> handle)
 	else if (_Handle->IsNull())
 	{
 		_Type = JSV_Null;
+		_ValueIsCurrent = 1;
 	}
 	else if (_Handle->IsFunction())
 	{
@@ -198,6 +216,7 @@ HandleProxy* HandleProxy::SetHandle(v8::Handle<Value> handle)
 	else if (_Handle->IsUndefined())
 	{
 		_Type = JSV_Undefined;
+		_ValueIsCurrent = 1;
 	}
 	else if (_Handle->IsObject()) // WARNING: Do this AFTER any possible object type checks (example: creating functions makes this return true as well!!!)
 	{
@@ -248,29 +267,25 @@ int32_t HandleProxy::SetManagedObjectID(int32_t id)
 	else if (_ObjectID == -1)
 		_ObjectID = _EngineProxy->GetNextNonTemplateObjectID(); // (must return something to associate accessor delegates, etc.)
 
-	// ... detect if this is a special "type" object ...
+	// ... detect if this is a special "type" object (these are tagged natively when created [see 'SetCLRTypeID()']) ...
 	if (_ObjectID < -2 && _Handle->IsObject())
 	{
-		// ... use "duck typing" to determine if the handle is a valid TypeInfo object ...
-		auto obj = _Handle.As<Object>();
-		auto hTypeID = obj->Get(_EngineProxy->Context(), NewString("$__TypeID"));
-		if (!hTypeID.IsEmpty())
-		{
-			auto lhTypeID = hTypeID.ToLocalChecked();
-			if (lhTypeID->IsNumber() || lhTypeID->IsInt32())
-			{
-				int32_t typeID = lhTypeID->IsNumber() ? lhTypeID->Int32Value(_EngineProxy->Context()).FromJust() : (int32_t)lhTypeID->NumberValue(_EngineProxy->Context()).FromJust();
-				if (obj->Has(_EngineProxy->Context(), NewString("$__Value")).FromMaybe(false))
-				{
-					_CLRTypeID = typeID;
-				}
-			}
-		}
+		auto hTypeID = _EngineProxy->GetObjectPrivateValue(_Handle.As<Object>(), PK_CLRTypeID);
+		if (hTypeID->IsInt32())
+			_CLRTypeID = hTypeID.As<Int32>()->Value();
 	}
 
 	return _ObjectID;
 }
 
+bool HandleProxy::SetCLRTypeID(int32_t typeID)
+{
+	if (_Handle.IsEmpty() || !_Handle->IsObject()) return false;
+	_EngineProxy->SetObjectPrivateValue(_Handle.As<Object>(), PK_CLRTypeID, NewInteger(typeID));
+	_CLRTypeID = typeID;
+	return true;
+}
+
 // Should be called once to attempt to pull the ID.
 // If there's no ID, then the managed object ID will be set to -2 to prevent checking again.
 // To force a re-check, simply set the value back to -1.
@@ -305,8 +320,8 @@ int32_t HandleProxy::GetManagedObjectID(v8::Handle<Value> h)
 		}
 		else
 		{
-			auto priv_sym = Private::ForApi(Isolate::GetCurrent(), NewString("ManagedObjectID")); // TODO: Better way to do this?
-			auto handle = obj->GetPrivate(Isolate::GetCurrent()->GetEnteredContext(), priv_sym);
+			auto engine = (V8EngineProxy*)Isolate::GetCurrent()->GetData(0);
+			auto handle = obj->GetPrivate(Isolate::GetCurrent()->GetEnteredContext(), engine->GetPrivateKey(PK_ManagedObjectID)); // (the key is cached by the engine)
 			if (!handle.IsEmpty())
 			{
 				auto value = handle.ToLocalChecked();
@@ -377,6 +392,7 @@ void HandleProxy::UpdateValue()
 	if (_Type == JSV_Script) return;
 
 	_Value.Dispose();
+	_ValueIsCurrent = 0;
 
 	switch (_Type)
 	{
@@ -385,11 +401,13 @@ void HandleProxy::UpdateValue()
 		case JSV_Null:
 		{
 			_Value.V8Number = 0;
+			_ValueIsCurrent = 1;
 			break;
 		}
 		case JSV_Bool:
 		{
 			_Value.V8Boolean = _Handle->BooleanValue(_EngineProxy->Context()).FromJust();
+			_ValueIsCurrent = 1;
 			break;
 		}
 		case JSV_BoolObject:
@@ -400,11 +418,13 @@ void HandleProxy::UpdateValue()
 		case JSV_Int32:
 		{
 			_Value.V8Integer = _Handle->Int32Value(_EngineProxy->Context()).FromJust();
+			_ValueIsCurrent = 1;
 			break;
 		}
 		case JSV_Number:
 		{
 			_Value.V8Number = _Handle->NumberValue(_EngineProxy->Context()).FromJust();
+			_ValueIsCurrent = 1;
 			break;
 		}
 		case JSV_NumberObject:
@@ -416,9 +436,17 @@ void HandleProxy::UpdateValue()
 		case JSV_ExecutionError:
 		case JSV_CompilerError:
 		case JSV_InternalError:
+		{
+			if (_Error != nullptr)
+				_Value.V8String = _Error->FormatErrorText(); // (the error text is only built when requested)
+			else
+				_Value.V8String = _StringItem(_EngineProxy, *_Handle.As<String>()).String;
+			break;
+		}
 		case JSV_String:
 		{
 			_Value.V8String = _StringItem(_EngineProxy, *_Handle.As<String>()).String; // (note: string is not disposed by struct object and becomes owned by this proxy!)
+			_ValueIsCurrent = 1; // (strings never change, so the copy can be reused)
 			break;
 		}
 		case JSV_StringObject:
@@ -428,23 +456,101 @@ void HandleProxy::UpdateValue()
 		}
 		case JSV_Date:
 		{
-			_Value.V8Number = _Handle->NumberValue(_EngineProxy->Context()).FromJust();
-			_Value.V8String = _StringItem(_EngineProxy, *_Handle.As<String>()).String;
+			_Value.V8Number = _Handle->NumberValue(_EngineProxy->Context()).FromJust(); // (the date text is only rendered by 'UpdateValueText()')
 			break;
 		}
 		case JSV_Undefined:
 		case JSV_Uninitialized:
 		{
 			_Value.V8Number = 0; // (make sure this is cleared just in case...)
+			_ValueIsCurrent = _Type == JSV_Undefined;
 			break;
 		}
 		default: // (by default, an "object" type is assumed (warning: this includes functions); however, we can't translate it (obviously), so we just return a reference to this handle proxy instead)
 		{
-			if (!_Handle.IsEmpty())
-				_Value.V8String = _StringItem(_EngineProxy, *_Handle->ToString(_EngineProxy->Isolate())).String;
+			// (the 'ToString()' text is only rendered by 'UpdateValueText()')
 			break;
 		}
 	}
 }
 
+// Same as 'UpdateValue()', but also renders the 'ToString()' text of dates and objects into '_Value.V8String'.  This is kept
+// separate because converting an object to a string can be expensive (and may even call back into script).
+void HandleProxy::UpdateValueText()
+{
+	UpdateValue();
+
+	if (_Value.V8String != nullptr || _Handle.IsEmpty()) return;
+
+	switch (_Type)
+	{
+		case JSV_Script:
+		case JSV_Null:
+		case JSV_Bool:
+		case JSV_BoolObject:
+		case JSV_Int32:
+		case JSV_Number:
+		case JSV_NumberObject:
+		case JSV_Undefined:
+		case JSV_Uninitialized:
+			return;
+		default: // (dates and objects)
+		{
+			Local<String> str;
+			if (_Handle->ToString(_EngineProxy->Context()).ToLocal(&str))
+				_Value.V8String = _StringItem(_EngineProxy, *str).String;
+			break;
+		}
+	}
+}
+
+// ------------------------------------------------------------------------------------------------------------------------
+
+Local<String> HandleProxy::GetErrorText()
+{
+	if (_Error != nullptr)
+	{
+		auto text = _Error->FormatErrorText();
+		auto str = NewUString(text);
+		FREE_MANAGED_MEM(text);
+		return str;
+	}
+	return _Handle->ToString(_EngineProxy->Isolate());
+}
+
+// ------------------------------------------------------------------------------------------------------------------------
+
+// Gets the string for handles that represent strings (or string objects).  Returns false for all other handle types.
+static bool _GetStringHandle(Local<Value> handle, Local<String> &str)
+{
+	if (handle.IsEmpty()) return false;
+	if (handle->IsString())
+		str = handle.As<String>();
+	else if (handle->IsStringObject())
+		str = handle.As<StringObject>()->ValueOf();
+	else
+		return false;
+	return true;
+}
+
+int32_t HandleProxy::GetStringLength()
+{
+	Local<String> str;
+	if (_Type == JSV_Script || !_GetStringHandle(_Handle, str)) return -1;
+	return str->Length();
+}
+
+int32_t HandleProxy::ReadString(uint16_t* buffer, int32_t start, int32_t length)
+{
+	Local<String> str;
+	if (_Type == JSV_Script || !_GetStringHandle(_Handle, str)) return -1;
+
+	auto strLength = str->Length();
+	if (buffer == nullptr || start < 0 || start >= strLength || length <= 0) return 0;
+	if (length > strLength - start)
+		length = strLength - start;
+
+	return str->Write(_EngineProxy->Isolate(), buffer, start, length, String::NO_NULL_TERMINATION);
+}
+
 // ------------------------------------------------------------------------------------------------------------------------
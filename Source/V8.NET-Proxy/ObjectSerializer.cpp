@@ -0,0 +1,400 @@
+#include "ProxyTypes.h"
+
+// ------------------------------------------------------------------------------------------------------------------------
+
+ObjectSerializer::ObjectSerializer(V8EngineProxy* engineProxy, byte* buffer, int32_t capacity, int32_t maxDepth, int32_t maxSize)
+	: _EngineProxy(engineProxy), _Context(engineProxy->Context()), _Buffer(buffer), _Capacity(buffer != nullptr ? capacity : 0), _Length(0), _OwnsBuffer(false),
+	_MaxDepth(maxDepth), _MaxSize(maxSize), _Result(SR_Success)
+{
+}
+
+// ------------------------------------------------------------------------------------------------------------------------
+
+// Makes sure there's room for 'size' more bytes, growing the buffer if needed.
+bool ObjectSerializer::_Reserve(int32_t size)
+{
+	if ((int64_t)_Length + size > _MaxSize)
+	{
+		_Result = SR_MaxSizeExceeded;
+		return false;
+	}
+
+	if (_Length + size <= _Capacity)
+		return true;
+
+	// ... double the buffer size until it fits (but don't go past the size limit) ...
+
+	int64_t newCapacity = _Capacity > 0 ? _Capacity : 1024;
+	while (newCapacity < _Length + size)
+		newCapacity *= 2;
+	if (newCapacity > _MaxSize)
+		newCapacity = _MaxSize;
+
+	byte* newBuffer;
+
+	if (_OwnsBuffer)
+		newBuffer = (byte*)REALLOC_MANAGED_MEM(_Buffer, (size_t)newCapacity);
+	else
+	{
+		newBuffer = (byte*)ALLOC_MANAGED_MEM((size_t)newCapacity);
+		if (newBuffer != nullptr && _Length > 0)
+			memcpy(newBuffer, _Buffer, _Length); // (the caller's buffer is left as is; the caller still owns it)
+	}
+
+	if (newBuffer == nullptr)
+	{
+		_Result = SR_MaxSizeExceeded;
+		return false;
+	}
+
+	_Buffer = newBuffer;
+	_Capacity = (int32_t)newCapacity;
+	_OwnsBuffer = true;
+
+	return true;
+}
+
+// ------------------------------------------------------------------------------------------------------------------------
+
+bool ObjectSerializer::_WriteString(Local<String> str, bool tagged)
+{
+	auto length = str->Length();
+
+	if (!_Reserve((tagged ? 1 : 0) + (int32_t)sizeof(int32_t) + length * (int32_t)sizeof(uint16_t)))
+		return false;
+
+	if (tagged)
+		_Write(ST_String);
+	_Write(length);
+
+	// ... the characters are written directly into the buffer (no intermediate copy) ...
+	str->Write(_EngineProxy->Isolate(), (uint16_t*)(_Buffer + _Length), 0, length, String::NO_NULL_TERMINATION);
+	_Length += length * sizeof(uint16_t);
+
+	return true;
+}
+
+bool ObjectSerializer::_WriteObject(Local<Object> obj, int32_t depth)
+{
+	// ... check if this object is already being written further up the path ...
+
+	for (size_t i = 0; i < _Path.size(); i++)
+		if (_Path[i] == obj)
+		{
+			_Result = SR_CycleDetected;
+			return false;
+		}
+
+	_Path.push_back(obj);
+
+	if (obj->IsArray())
+	{
+		auto array = obj.As<Array>();
+		int32_t length = (int32_t)array->Length();
+
+		if (!_Reserve(1 + sizeof(int32_t))) return false;
+		_Write(ST_Array);
+		_Write(length);
+
+		for (int32_t i = 0; i < length; i++)
+		{
+			Local<Value> item;
+			if (!array->Get(_Context, (uint32_t)i).ToLocal(&item))
+			{
+				_Result = SR_ScriptError;
+				return false;
+			}
+			if (!_WriteValue(item, depth + 1)) return false;
+		}
+	}
+	else
+	{
+		Local<Array> names;
+		if (!obj->GetOwnPropertyNames(_Context).ToLocal(&names))
+		{
+			_Result = SR_ScriptError;
+			return false;
+		}
+
+		int32_t count = (int32_t)names->Length();
+
+		if (!_Reserve(1 + sizeof(int32_t))) return false;
+		_Write(ST_Object);
+		_Write(count);
+
+		for (int32_t i = 0; i < count; i++)
+		{
+			Local<Value> name, value;
+			Local<String> nameStr;
+			if (!names->Get(_Context, (uint32_t)i).ToLocal(&name) || !name->ToString(_Context).ToLocal(&nameStr)
+				|| !obj->Get(_Context, name).ToLocal(&value))
+			{
+				_Result = SR_ScriptError;
+				return false;
+			}
+			if (!_WriteString(nameStr, false) || !_WriteValue(value, depth + 1)) return false;
+		}
+	}
+
+	_Path.pop_back();
+
+	return true;
+}
+
+bool ObjectSerializer::_WriteValue(Local<Value> value, int32_t depth)
+{
+	if (depth > _MaxDepth)
+	{
+		_Result = SR_MaxDepthExceeded;
+		return false;
+	}
+
+	if (value->IsString())
+		return _WriteString(value.As<String>(), true);
+
+	if (value->IsInt32())
+	{
+		if (!_Reserve(1 + sizeof(int32_t))) return false;
+		_Write(ST_Int32);
+		_Write(value.As<Int32>()->Value());
+		return true;
+	}
+
+	if (value->IsNumber())
+	{
+		if (!_Reserve(1 + sizeof(double))) return false;
+		_Write(ST_Number);
+		_Write(value.As<Number>()->Value());
+		return true;
+	}
+
+	if (value->IsDate())
+	{
+		if (!_Reserve(1 + sizeof(double))) return false;
+		_Write(ST_Date);
+		_Write(value.As<Date>()->ValueOf());
+		return true;
+	}
+
+	// ... boxed values are written as their primitive values ...
+
+	if (value->IsStringObject())
+		return _WriteString(value.As<StringObject>()->ValueOf(), true);
+
+	if (value->IsNumberObject())
+	{
+		if (!_Reserve(1 + sizeof(double))) return false;
+		_Write(ST_Number);
+		_Write(value.As<NumberObject>()->ValueOf());
+		return true;
+	}
+
+	if (!_Reserve(1)) return false;
+
+	if (value->IsBooleanObject())
+		_Write(value.As<BooleanObject>()->ValueOf() ? ST_True : ST_False);
+	else if (value->IsTrue())
+		_Write(ST_True);
+	else if (value->IsFalse())
+		_Write(ST_False);
+	else if (value->IsNull())
+		_Write(ST_Null);
+	else if (value->IsFunction() || value->IsSymbol() || value->IsExternal() || !value->IsObject())
+		_Write(ST_Undefined); // (also covers 'undefined' itself)
+	else
+		return _WriteObject(value.As<Object>(), depth); // (writes its own tag)
+
+	return true;
+}
+
+// ------------------------------------------------------------------------------------------------------------------------
+
+int32_t ObjectSerializer::Serialize(Local<Value> value)
+{
+	if (value.IsEmpty())
+		return SR_InvalidValue;
+
+	TryCatch __tryCatch(_EngineProxy->Isolate());
+
+	_Length = 0;
+	_Path.clear();
+	_Result = SR_Success;
+
+	if (!_WriteValue(value, 0) || __tryCatch.HasCaught())
+		return _Result != SR_Success ? _Result : SR_ScriptError;
+
+	return _Length;
+}
+
+// ------------------------------------------------------------------------------------------------------------------------
+
+ObjectDeserializer::ObjectDeserializer(V8EngineProxy* engineProxy, const byte* data, int32_t length, int32_t maxDepth)
+	: _EngineProxy(engineProxy), _Context(engineProxy->Context()), _Data(data), _Length(data != nullptr ? length : 0), _Position(0),
+	_MaxDepth(maxDepth), _Result(SR_Success)
+{
+}
+
+// ------------------------------------------------------------------------------------------------------------------------
+
+// Makes sure there are at least 'size' more bytes left to read.
+bool ObjectDeserializer::_Require(int64_t size)
+{
+	if (size < 0 || _Position + size > _Length)
+	{
+		_Result = SR_InvalidValue;
+		return false;
+	}
+	return true;
+}
+
+bool ObjectDeserializer::_Read(int32_t &value)
+{
+	if (!_Require(sizeof(value))) return false;
+	memcpy(&value, _Data + _Position, sizeof(value));
+	_Position += sizeof(value);
+	return true;
+}
+
+bool ObjectDeserializer::_Read(double &value)
+{
+	if (!_Require(sizeof(value))) return false;
+	memcpy(&value, _Data + _Position, sizeof(value));
+	_Position += sizeof(value);
+	return true;
+}
+
+bool ObjectDeserializer::_ReadString(Local<String> &str, bool internalize)
+{
+	int32_t length;
+	if (!_Read(length) || !_Require((int64_t)length * sizeof(uint16_t))) return false;
+
+	// ... the characters are read directly from the buffer (no intermediate copy) ...
+	if (!String::NewFromTwoByte(_EngineProxy->Isolate(), (const uint16_t*)(_Data + _Position), internalize ? NewStringType::kInternalized : NewStringType::kNormal, length)
+		.ToLocal(&str))
+	{
+		_Result = SR_MaxSizeExceeded; // (the string is too long for V8)
+		return false;
+	}
+	_Position += length * sizeof(uint16_t);
+
+	return true;
+}
+
+bool ObjectDeserializer::_ReadValue(Local<Value> &value, int32_t depth)
+{
+	if (depth > _MaxDepth)
+	{
+		_Result = SR_MaxDepthExceeded;
+		return false;
+	}
+
+	if (!_Require(1)) return false;
+
+	auto tag = (SerializedType)_Data[_Position++];
+
+	switch (tag)
+	{
+	case ST_Undefined: value = V8Undefined; return true;
+	case ST_Null: value = V8Null; return true;
+	case ST_False: value = NewBool(false); return true;
+	case ST_True: value = NewBool(true); return true;
+	case ST_Int32:
+	{
+		int32_t i;
+		if (!_Read(i)) return false;
+		value = NewInteger(i);
+		return true;
+	}
+	case ST_Number:
+	{
+		double n;
+		if (!_Read(n)) return false;
+		value = NewNumber(n);
+		return true;
+	}
+	case ST_Date:
+	{
+		double ms;
+		if (!_Read(ms)) return false;
+		if (!Date::New(_Context, ms).ToLocal(&value))
+		{
+			_Result = SR_ScriptError;
+			return false;
+		}
+		return true;
+	}
+	case ST_String:
+	{
+		Local<String> str;
+		if (!_ReadString(str, false)) return false;
+		value = str;
+		return true;
+	}
+	case ST_Array:
+	{
+		int32_t count;
+		if (!_Read(count) || !_Require(count)) return false; // (each item is at least one byte)
+
+		auto array = NewArray(count);
+
+		for (int32_t i = 0; i < count; i++)
+		{
+			Local<Value> item;
+			if (!_ReadValue(item, depth + 1)) return false;
+			if (!array->CreateDataProperty(_Context, (uint32_t)i, item).FromMaybe(false))
+			{
+				_Result = SR_ScriptError;
+				return false;
+			}
+		}
+
+		value = array;
+		return true;
+	}
+	case ST_Object:
+	{
+		int32_t count;
+		if (!_Read(count) || !_Require(count)) return false; // (each property is at least one byte)
+
+		auto obj = NewObject();
+
+		for (int32_t i = 0; i < count; i++)
+		{
+			Local<String> name;
+			Local<Value> item;
+			if (!_ReadString(name, true) || !_ReadValue(item, depth + 1)) return false;
+			if (!obj->CreateDataProperty(_Context, name, item).FromMaybe(false))
+			{
+				_Result = SR_ScriptError;
+				return false;
+			}
+		}
+
+		value = obj;
+		return true;
+	}
+	default:
+		_Result = SR_InvalidValue;
+		return false;
+	}
+}
+
+// ------------------------------------------------------------------------------------------------------------------------
+
+SerializerResult ObjectDeserializer::Deserialize(Local<Value> &value)
+{
+	TryCatch __tryCatch(_EngineProxy->Isolate());
+
+	_Position = 0;
+	_Result = SR_Success;
+
+	if (!_ReadValue(value, 0) || __tryCatch.HasCaught())
+		return _Result != SR_Success ? _Result : SR_ScriptError;
+
+	if (_Position != _Length)
+		return SR_InvalidValue; // (there's unexpected data after the value)
+
+	return SR_Success;
+}
+
+// ------------------------------------------------------------------------------------------------------------------------
@@ -0,0 +1,190 @@
+#include "ProxyTypes.h"
+
+// ------------------------------------------------------------------------------------------------------------------------
+
+ObjectShape::ObjectShape(V8EngineProxy* engineProxy, int32_t id, const uint16_t** names, const ShapeFieldType* types, int32_t count)
+	: _EngineProxy(engineProxy), _ID(id), _Names(nullptr), _Size(0)
+{
+	auto templ = NewObjectTemplate();
+
+	_Names = new CopyablePersistent<String>[count];
+	_Types.resize(count);
+	_Offsets.resize(count);
+
+	for (auto i = 0; i < count; i++)
+	{
+		Local<String> name = NewInternalizedUString(names[i]);
+		_Names[i] = name;
+		_Types[i] = types[i];
+		_Offsets[i] = _Size;
+		_Size += GetFieldSize(types[i]);
+
+		templ->Set(name, V8Undefined); // (so all instances start out with all the properties, in order)
+	}
+
+	_Template = templ;
+}
+
+ObjectShape::~ObjectShape()
+{
+	for (size_t i = 0; i < _Types.size(); i++)
+		_Names[i].Reset();
+	delete[] _Names;
+	_Names = nullptr;
+	_Template.Reset();
+	_EngineProxy = nullptr;
+}
+
+int32_t ObjectShape::GetFieldSize(ShapeFieldType type)
+{
+	switch (type)
+	{
+	case SF_Boolean: return 1;
+	case SF_Int32: return 4;
+	default: return 8;
+	}
+}
+
+// ------------------------------------------------------------------------------------------------------------------------
+
+int32_t ObjectShape::Extract(Local<Object> obj, byte* buffer)
+{
+	auto ctx = _EngineProxy->Context();
+	int32_t mismatches = 0;
+
+	memset(buffer, 0, _Size);
+
+	for (size_t i = 0; i < _Types.size(); i++)
+	{
+		Local<Value> value;
+		if (!obj->Get(ctx, _Names[i].Handle()).ToLocal(&value))
+		{
+			// ... the caller never sees the values, so release the handles created so far as well ...
+			for (size_t j = 0; j < i; j++)
+				if (_Types[j] == SF_Handle)
+				{
+					int64_t ptr;
+					memcpy(&ptr, buffer + _Offsets[j], sizeof(ptr));
+					if (ptr != 0) ((HandleProxy*)ptr)->TryDispose();
+				}
+			FreeValues(buffer);
+			memset(buffer, 0, _Size);
+			return -1;
+		}
+
+		auto field = buffer + _Offsets[i];
+		auto match = true;
+
+		switch (_Types[i])
+		{
+		case SF_Boolean:
+			if ((match = value->IsBoolean())) *field = value->IsTrue() ? 1 : 0;
+			break;
+		case SF_Int32:
+		{
+			int32_t n = 0;
+			if ((match = value->IsInt32())) n = value.As<Int32>()->Value();
+			memcpy(field, &n, sizeof(n));
+			break;
+		}
+		case SF_Number:
+		{
+			double n = std::numeric_limits<double>::quiet_NaN();
+			if ((match = value->IsNumber())) n = value.As<Number>()->Value();
+			memcpy(field, &n, sizeof(n));
+			break;
+		}
+		case SF_Date:
+		{
+			double ms = std::numeric_limits<double>::quiet_NaN();
+			if ((match = value->IsDate())) ms = value.As<Date>()->ValueOf();
+			memcpy(field, &ms, sizeof(ms));
+			break;
+		}
+		case SF_String:
+		{
+			int64_t ptr = 0;
+			if ((match = value->IsString())) ptr = (int64_t)_StringItem(_EngineProxy, *value.As<String>()).String;
+			memcpy(field, &ptr, sizeof(ptr));
+			break;
+		}
+		case SF_Handle:
+		{
+			auto ptr = (int64_t)_EngineProxy->GetHandleProxy(value);
+			memcpy(field, &ptr, sizeof(ptr));
+			break;
+		}
+		}
+
+		if (!match) mismatches++;
+	}
+
+	return mismatches;
+}
+
+// ------------------------------------------------------------------------------------------------------------------------
+
+MaybeLocal<Object> ObjectShape::Create(const byte* buffer)
+{
+	auto ctx = _EngineProxy->Context();
+	Local<Object> obj;
+	auto created = _Template->NewInstance(ctx).ToLocal(&obj);
+
+	for (size_t i = 0; i < _Types.size(); i++)
+	{
+		auto field = buffer + _Offsets[i];
+		Local<Value> value;
+
+		switch (_Types[i])
+		{
+		case SF_Boolean: value = NewBool(*field != 0); break;
+		case SF_Int32: { int32_t n; memcpy(&n, field, sizeof(n)); value = NewInteger(n); break; }
+		case SF_Number: { double n; memcpy(&n, field, sizeof(n)); value = NewNumber(n); break; }
+		case SF_Date: { double ms; memcpy(&ms, field, sizeof(ms)); value = NewDate(ctx, ms); break; }
+		case SF_String:
+		{
+			int64_t ptr; memcpy(&ptr, field, sizeof(ptr));
+			value = ptr != 0 ? (Local<Value>)NewUString((uint16_t*)ptr) : (Local<Value>)V8Null;
+			break;
+		}
+		case SF_Handle:
+		{
+			int64_t ptr; memcpy(&ptr, field, sizeof(ptr));
+			auto handle = (HandleProxy*)ptr;
+			if (handle != nullptr)
+			{
+				value = handle->Handle();
+				handle->TryDispose(); // (as with other handles passed in from the managed side)
+			}
+			else value = V8Undefined;
+			break;
+		}
+		}
+
+		if (created && !obj->CreateDataProperty(ctx, _Names[i].Handle(), value).FromMaybe(false))
+			created = false; // (keep going, so any remaining handles passed in are still released)
+	}
+
+	return created ? MaybeLocal<Object>(obj) : MaybeLocal<Object>();
+}
+
+// ------------------------------------------------------------------------------------------------------------------------
+
+void ObjectShape::FreeValues(byte* buffer)
+{
+	for (size_t i = 0; i < _Types.size(); i++)
+		if (_Types[i] == SF_String)
+		{
+			int64_t ptr;
+			memcpy(&ptr, buffer + _Offsets[i], sizeof(ptr));
+			if (ptr != 0)
+			{
+				auto str = (uint16_t*)ptr;
+				FREE_MANAGED_MEM(str);
+				ptr = 0;
+				memcpy(buffer + _Offsets[i], &ptr, sizeof(ptr));
+			}
+		}
+}
+
+// ------------------------------------------------------------------------------------------------------------------------
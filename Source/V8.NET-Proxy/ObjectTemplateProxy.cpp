@@ -7,7 +7,7 @@ ObjectTemplateProxy::ObjectTemplateProxy(V8EngineProxy* engineProxy)
 {
 	_ObjectID = _EngineProxy->GetNextNonTemplateObjectID(); // ("ObjectTemplateProxy" will qualify as a non-template-created object in this case)
 	auto obj = NewObjectTemplate();
-	obj->SetInternalFieldCount(2); // (one for the associated proxy, and one for the associated managed object ID)
+	obj->SetInternalFieldCount(TOF_Count); // (the associated proxy, the associated managed object ID, a data pointer, and the property cache with its version [see 'TemplateObjectField'])
 	_ObjectTemplate = CopyablePersistent<ObjectTemplate>(obj);
 }
 
@@ -15,7 +15,7 @@ ObjectTemplateProxy::ObjectTemplateProxy(V8EngineProxy* engineProxy, Local<Objec
 	:ProxyBase(ObjectTemplateProxyClass), _EngineProxy(engineProxy), _EngineID(engineProxy->_EngineID)
 {
 	_ObjectID = _EngineProxy->GetNextNonTemplateObjectID(); // ("ObjectTemplateProxy" will qualify as a non-template-created object in this case)
-	objectTemplate->SetInternalFieldCount(2); // (one for the associated proxy, and one for the associated managed object ID)
+	objectTemplate->SetInternalFieldCount(TOF_Count); // (the associated proxy, the associated managed object ID, a data pointer, and the property cache with its version [see 'TemplateObjectField'])
 	_ObjectTemplate = CopyablePersistent<ObjectTemplate>(objectTemplate);
 }
 
@@ -130,8 +130,19 @@ void ObjectTemplateProxy::GetProperty(Local<Name> hName, const PropertyCallbackI
 		{
 			if (proxy != nullptr && proxy->_EngineProxy != nullptr && proxy->Type == ObjectTemplateProxyClass)
 			{
-				auto managedObjectID = (int32_t)(int64_t)obj->GetInternalField(1).As<External>()->Value();
 				auto engine = proxy->_EngineProxy;
+
+				// ... return any value the managed side allowed to be cached, without leaving native code ...
+
+				auto cache = GetPropertyCache(engine, obj, false);
+				Local<Value> cachedValue;
+				if (!cache.IsEmpty() && cache->Get(engine->Context(), hName).ToLocal(&cachedValue) && !cachedValue->IsUndefined())
+				{
+					info.GetReturnValue().Set(cachedValue);
+					return;
+				}
+
+				auto managedObjectID = (int32_t)(int64_t)obj->GetInternalField(1).As<External>()->Value();
 				ManagedAccessorInfo maInfo(proxy, managedObjectID, info);
 				auto hNameStr = hName->IsSymbol() ? hName.As<Symbol>()->Name().As<String>() : hName.As<String>();
 				auto str = engine->GetNativeString(*hNameStr); // TODO: This can be faster - no need to allocate every time!
@@ -146,9 +157,19 @@ void ObjectTemplateProxy::GetProperty(Local<Name> hName, const PropertyCallbackI
 				if (result != nullptr)
 				{
 					if (result->IsError())
-						info.GetReturnValue().Set(ThrowException(Exception::Error(result->Handle()->ToString(info.GetIsolate()))));
+						info.GetReturnValue().Set(ThrowException(Exception::Error(result->GetErrorText())));
 					else
-						info.GetReturnValue().Set(result->Handle()); // (the result was create via p/invoke calls, but is expected to be tracked and freed on the managed side)
+					{
+						auto hResult = result->Handle();
+						info.GetReturnValue().Set(hResult); // (the result was create via p/invoke calls, but is expected to be tracked and freed on the managed side)
+
+						if ((maInfo.ResultFlags & MARF_Cacheable) != 0 && !hResult->IsUndefined())
+						{
+							cache = GetPropertyCache(engine, obj, true);
+							if (!cache.IsEmpty() && cache->Set(engine->Context(), hName, hResult).IsEmpty())
+								cache->Clear(); // (the value could not be cached, so make sure no older one is left behind)
+						}
+					}
 
 					result->TryDispose();
 				}
@@ -160,6 +181,37 @@ void ObjectTemplateProxy::GetProperty(Local<Name> hName, const PropertyCallbackI
 
 // ------------------------------------------------------------------------------------------------------------------------
 
+Local<v8::Map> ObjectTemplateProxy::GetPropertyCache(V8EngineProxy* engine, const Local<Object> &obj, bool create)
+{
+	if (obj->InternalFieldCount() <= TOF_PropertyCacheVersion)
+		return Local<v8::Map>();
+
+	auto field = obj->GetInternalField(TOF_PropertyCache);
+	auto version = engine->PropertyCacheVersion();
+
+	if (field->IsMap())
+	{
+		auto cache = field.As<v8::Map>();
+		auto cacheVersion = obj->GetInternalField(TOF_PropertyCacheVersion);
+		if (!cacheVersion->IsInt32() || cacheVersion.As<Int32>()->Value() != version)
+		{
+			cache->Clear();
+			obj->SetInternalField(TOF_PropertyCacheVersion, NewInteger(version));
+		}
+		return cache;
+	}
+
+	if (!create)
+		return Local<v8::Map>();
+
+	auto cache = v8::Map::New(engine->Isolate());
+	obj->SetInternalField(TOF_PropertyCache, cache);
+	obj->SetInternalField(TOF_PropertyCacheVersion, NewInteger(version));
+	return cache;
+}
+
+// ------------------------------------------------------------------------------------------------------------------------
+
 void ObjectTemplateProxy::SetProperty(Local<Name> hName, Local<Value> value, const PropertyCallbackInfo<Value>& info)
 {
 	auto obj = info.Holder();
@@ -186,12 +238,17 @@ void ObjectTemplateProxy::SetProperty(Local<Name> hName, Local<Value> value, con
 				}
 				catch (...) { ThrowException(NewString("'NamedPropertySetter' no longer exists - perhaps the GC collected it.")); }
 				engine->_InCallbackScope--;
+
+				auto cache = GetPropertyCache(engine, obj, false); // (the value may have changed, so don't return a cached one)
+				if (!cache.IsEmpty() && cache->Delete(engine->Context(), hName).IsNothing())
+					cache->Clear(); // (the stale value could not be removed, so drop them all)
+
 				engine->ProcessHandleQueues(); // (since setting properties may dispose another, do this at least once)
 				str.Dispose();
 				if (result != nullptr)
 				{
 					if (result->IsError())
-						info.GetReturnValue().Set(ThrowException(Exception::Error(result->Handle()->ToString(info.GetIsolate()))));
+						info.GetReturnValue().Set(ThrowException(Exception::Error(result->GetErrorText())));
 					else
 						info.GetReturnValue().Set(result->Handle()); // (the result was create via p/invoke calls, but is expected to be tracked and freed on the managed side)
 
@@ -268,6 +325,10 @@ void ObjectTemplateProxy::DeleteProperty(Local<Name> hName, const PropertyCallba
 				proxy->_EngineProxy->_InCallbackScope--;
 				str.Dispose();
 
+				auto cache = GetPropertyCache(proxy->_EngineProxy, obj, false);
+				if (!cache.IsEmpty() && cache->Delete(proxy->_EngineProxy->Context(), hName).IsNothing())
+					cache->Clear(); // (the stale value could not be removed, so drop them all)
+
 				// if 'result' is < 0, then this represents an "undefined" return value, otherwise 0 == false, and > 0 is true.
 
 				if (result >= 0)
@@ -306,7 +367,7 @@ void ObjectTemplateProxy::GetPropertyNames(const PropertyCallbackInfo<Array>& in
 					if (result->IsError())
 					{
 						auto array = NewArray(1);
-						array->Set(0, ThrowException(Exception::Error(result->Handle()->ToString(info.GetIsolate()))));
+						array->Set(0, ThrowException(Exception::Error(result->GetErrorText())));
 						info.GetReturnValue().Set(array);
 					}
 					else
@@ -347,7 +408,7 @@ void ObjectTemplateProxy::GetProperty(uint32_t index, const PropertyCallbackInfo
 				if (result != nullptr)
 				{
 					if (result->IsError())
-						info.GetReturnValue().Set(ThrowException(Exception::Error(result->Handle()->ToString(info.GetIsolate()))));
+						info.GetReturnValue().Set(ThrowException(Exception::Error(result->GetErrorText())));
 					else
 						info.GetReturnValue().Set(result->Handle()); // (the result was create via p/invoke calls, but is expected to be tracked and freed on the managed side)
 
@@ -388,7 +449,7 @@ void ObjectTemplateProxy::SetProperty(uint32_t index, Local<Value> value, const
 				if (result != nullptr)
 				{
 					if (result->IsError())
-						info.GetReturnValue().Set(ThrowException(Exception::Error(result->Handle()->ToString(info.GetIsolate()))));
+						info.GetReturnValue().Set(ThrowException(Exception::Error(result->GetErrorText())));
 					else
 						info.GetReturnValue().Set(result->Handle()); // (the result was create via p/invoke calls, but is expected to be tracked and freed on the managed side)
 
@@ -497,7 +558,7 @@ void ObjectTemplateProxy::GetPropertyIndices(const PropertyCallbackInfo<Array>&
 					if (result->IsError())
 					{
 						auto array = NewArray(1);
-						array->Set(0, ThrowException(Exception::Error(result->Handle()->ToString(info.GetIsolate()))));
+						array->Set(0, ThrowException(Exception::Error(result->GetErrorText())));
 						info.GetReturnValue().Set(array);
 					}
 					else
@@ -534,60 +595,47 @@ void ObjectTemplateProxy::AccessorGetterCallbackProxy(Local<Name> property, cons
 
 	if (!obj.IsEmpty())
 	{
-		auto hAccessors = info.Data().As<Array>(); // [0] = ManagedObjectID, [1] == getter, [2] == setter
-		if (hAccessors->Length() == 3)
+		auto accessors = (ManagedAccessors*)info.Data().As<External>()->Value(); // (see 'V8EngineProxy::CreateManagedAccessors()')
+		auto getter = accessors->Getter;
+
+		if (getter != nullptr)
 		{
 			auto engine = (V8EngineProxy*)info.GetIsolate()->GetData(0);
-			auto ctx = engine->Context(); // Context
-			auto hID = hAccessors->Get(0).As<Integer>(); // ManagedObjectID
-			auto managedObjectID = (int32_t)hID->Int32Value(ctx).ToChecked();
-			//??if (managedObjectID < 0 && obj->InternalFieldCount() >= 2) // (if the object ID is < 0 [usually -1] then try to detect the ID in other ways)
-			//    auto managedObjectID = (int32_t)obj->GetInternalField(1).As<External>()->Value(); // (for ObjectTemplate objects)
-			//else
-			//{
-			//    auto hHiddenObjID = obj->GetHiddenValue(String::New("ManagedObjectID")); // (for non-ObjectTemplate objects)
-			//    if (!hHiddenObjID.IsEmpty() && hHiddenObjID->IsInt32())
-			//        managedObjectID = (int32_t)hHiddenObjID->Int32Value();
-			//}
-
-			ManagedAccessorGetter getter = (ManagedAccessorGetter)hAccessors->Get(1).As<External>()->Value();
-
-			if (getter != nullptr)
-			{
-				auto _this = engine->GetHandleProxy(info.This());
-				if (managedObjectID >= 0) _this->_ObjectID = managedObjectID; // (use any explicitly specified object ID)
+			auto managedObjectID = accessors->ManagedObjectID;
 
-				auto str = engine->GetNativeString(*property->ToString(info.GetIsolate()));
+			auto _this = engine->GetHandleProxy(info.This());
+			if (managedObjectID >= 0) _this->_ObjectID = managedObjectID; // (use any explicitly specified object ID)
 
-				engine->_InCallbackScope++;
-				HandleProxy* result = nullptr;
-				try {
-					result = getter(_this, str.String); // (assumes the 'str' memory will be released by the managed side)
-				}
-				catch (...) { ThrowException(NewString("'AccessorGetterCallbackProxy' caused an error - perhaps the GC collected the delegate?")); }
-				engine->_InCallbackScope--;
-
-				str.Dispose();
+			auto str = engine->GetNativeString(*property->ToString(info.GetIsolate()));
 
-				Handle<Value> hResult;
+			engine->_InCallbackScope++;
+			HandleProxy* result = nullptr;
+			try {
+				result = getter(_this, str.String); // (assumes the 'str' memory will be released by the managed side)
+			}
+			catch (...) { ThrowException(NewString("'AccessorGetterCallbackProxy' caused an error - perhaps the GC collected the delegate?")); }
+			engine->_InCallbackScope--;
 
-				if (result != nullptr)
-				{
-					if (result->IsError())
-						hResult = ThrowException(Exception::Error(result->Handle()->ToString(info.GetIsolate()))); // TODO: Look into associating the returned error type as well (very low priority)
-					else
-						hResult = result->Handle(); // (the result was create via p/invoke calls, but is expected to be tracked and freed on the managed side)
-					// (result == null == undefined [which means the managed side didn't return anything])
+			str.Dispose();
 
-					result->TryDispose();
-				}
+			Handle<Value> hResult;
 
-				// ... do the following disposal LAST, as the result may be one of the arguments passed in ...
-				_this->TryDispose();
+			if (result != nullptr)
+			{
+				if (result->IsError())
+					hResult = ThrowException(Exception::Error(result->GetErrorText())); // TODO: Look into associating the returned error type as well (very low priority)
+				else
+					hResult = result->Handle(); // (the result was create via p/invoke calls, but is expected to be tracked and freed on the managed side)
+				// (result == null == undefined [which means the managed side didn't return anything])
 
-				ret.Set(hResult);
-				return;
+				result->TryDispose();
 			}
+
+			// ... do the following disposal LAST, as the result may be one of the arguments passed in ...
+			_this->TryDispose();
+
+			ret.Set(hResult);
+			return;
 		}
 	}
 
@@ -601,61 +649,48 @@ void ObjectTemplateProxy::AccessorSetterCallbackProxy(Local<Name> property, Loca
 
 	if (!obj.IsEmpty())
 	{
-		auto hAccessors = info.Data().As<Array>(); // [0] = ManagedObjectID, [1] == getter, [2] == setter
-		if (hAccessors->Length() == 3)
+		auto accessors = (ManagedAccessors*)info.Data().As<External>()->Value(); // (see 'V8EngineProxy::CreateManagedAccessors()')
+		auto setter = accessors->Setter;
+
+		if (setter != nullptr)
 		{
 			auto engine = (V8EngineProxy*)info.GetIsolate()->GetData(0);
-			auto ctx = engine->Context(); // Context
-			auto hID = hAccessors->Get(0).As<Integer>(); // ManagedObjectID
-			auto managedObjectID = (int32_t)hID->Int32Value(ctx).ToChecked();
-			//??if (managedObjectID < 0 && obj->InternalFieldCount() >= 2) // (if the object ID is < 0 [usually -1] then try to detect the ID in other ways)
-			//    auto managedObjectID = (int32_t)obj->GetInternalField(1).As<External>()->Value(); // (for ObjectTemplate objects)
-			//else
-			//{
-			//    auto hHiddenObjID = obj->GetHiddenValue(String::New("ManagedObjectID")); // (for non-ObjectTemplate objects)
-			//    if (!hHiddenObjID.IsEmpty() && hHiddenObjID->IsInt32())
-			//        managedObjectID = (int32_t)hHiddenObjID->Int32Value();
-			//}
-
-			ManagedAccessorSetter setter = (ManagedAccessorSetter)hAccessors->Get(2).As<External>()->Value();
-
-			if (setter != nullptr)
-			{
-				auto _this = engine->GetHandleProxy(info.This());
-				if (managedObjectID >= 0) _this->_ObjectID = managedObjectID; // (use any explicitly specified object ID)
+			auto managedObjectID = accessors->ManagedObjectID;
 
-				auto str = engine->GetNativeString(*property->ToString(info.GetIsolate()));
-				auto _value = engine->GetHandleProxy(value);
+			auto _this = engine->GetHandleProxy(info.This());
+			if (managedObjectID >= 0) _this->_ObjectID = managedObjectID; // (use any explicitly specified object ID)
 
-				engine->_InCallbackScope++;
-				HandleProxy* result = nullptr;
-				try {
-					result = setter(_this, str.String, _value); // (assumes the 'str' memory will be released by the managed side)
-				}
-				catch (...) { ThrowException(NewString("'AccessorSetterCallbackProxy' caused an error - perhaps the GC collected the delegate?")); }
-				engine->_InCallbackScope--;
+			auto str = engine->GetNativeString(*property->ToString(info.GetIsolate()));
+			auto _value = engine->GetHandleProxy(value);
 
-				str.Dispose();
+			engine->_InCallbackScope++;
+			HandleProxy* result = nullptr;
+			try {
+				result = setter(_this, str.String, _value); // (assumes the 'str' memory will be released by the managed side)
+			}
+			catch (...) { ThrowException(NewString("'AccessorSetterCallbackProxy' caused an error - perhaps the GC collected the delegate?")); }
+			engine->_InCallbackScope--;
 
-				Handle<Value> hResult;
+			str.Dispose();
 
-				if (result != nullptr)
-				{
-					if (result->IsError())
-						hResult = ThrowException(Exception::Error(result->Handle()->ToString(info.GetIsolate()))); // TODO: Look into associating the returned error type as well (very low priority)
-					else
-						hResult = result->Handle(); // (the result was create via p/invoke calls, but is expected to be tracked and freed on the managed side)
-					// (result == null == undefined [which means the managed side didn't return anything])
+			Handle<Value> hResult;
 
-					result->TryDispose();
-				}
-				// ... do the following disposal LAST, as the result may be one of the arguments passed in ...
-				_this->TryDispose();
-				_value->TryDispose();
+			if (result != nullptr)
+			{
+				if (result->IsError())
+					hResult = ThrowException(Exception::Error(result->GetErrorText())); // TODO: Look into associating the returned error type as well (very low priority)
+				else
+					hResult = result->Handle(); // (the result was create via p/invoke calls, but is expected to be tracked and freed on the managed side)
+				// (result == null == undefined [which means the managed side didn't return anything])
 
-				ret.Set(hResult);
-				return;
+				result->TryDispose();
 			}
+			// ... do the following disposal LAST, as the result may be one of the arguments passed in ...
+			_this->TryDispose();
+			_value->TryDispose();
+
+			ret.Set(hResult);
+			return;
 		}
 	}
 
@@ -666,13 +701,142 @@ void ObjectTemplateProxy::SetAccessor(int32_t managedObjectID, const uint16_t *n
 	ManagedAccessorGetter getter, ManagedAccessorSetter setter,
 	v8::AccessControl access, v8::PropertyAttribute attributes)
 {
-	auto accessors = NewArray(3); // [0] == ManagedObjectID, [1] == getter, [2] == setter
-	accessors->Set(0, NewInteger(managedObjectID));
-	accessors->Set(1, NewExternal(getter));
-	accessors->Set(2, NewExternal(setter));
+	auto accessors = _EngineProxy->CreateManagedAccessors(managedObjectID, getter, setter);
 	_ObjectTemplate->SetAccessor(NewUString(name), AccessorGetterCallbackProxy, AccessorSetterCallbackProxy, accessors, access, attributes);  // TODO: Check how this affects objects created from templates!
 }
 
+// ------------------------------------------------------------------------------------------------------------------------
+
+// Returns the memory location for a direct accessor, or null if the holder has no data pointer.
+static inline byte* _GetDirectAccessorField(const Local<Object> &obj, int32_t accessorData, DirectAccessorType &type)
+{
+	if (obj->InternalFieldCount() <= TOF_DataPointer || obj->GetInternalField(TOF_DataPointer)->IsUndefined())
+		return nullptr;
+
+	auto data = (byte*)obj->GetAlignedPointerFromInternalField(TOF_DataPointer);
+	if (data == nullptr)
+		return nullptr;
+
+	type = (DirectAccessorType)(accessorData & 0xF);
+	return data + (accessorData >> 4);
+}
+
+void ObjectTemplateProxy::DirectAccessorGetter(Local<Name> property, const PropertyCallbackInfo<Value>& info)
+{
+	DirectAccessorType type;
+	auto field = _GetDirectAccessorField(info.Holder(), info.Data().As<Int32>()->Value(), type);
+	auto ret = info.GetReturnValue();
+
+	if (field == nullptr)
+	{
+		ret.SetUndefined();
+		return;
+	}
+
+	// ... the memory may not be aligned (such as fields of packed structs), so values are copied out ...
+
+	switch (type)
+	{
+	case DA_Boolean: ret.Set(*field != 0); break;
+	case DA_Byte: ret.Set((int32_t)*field); break;
+	case DA_Int16: { int16_t v; memcpy(&v, field, sizeof(v)); ret.Set((int32_t)v); break; }
+	case DA_UInt16: { uint16_t v; memcpy(&v, field, sizeof(v)); ret.Set((int32_t)v); break; }
+	case DA_Int32: { int32_t v; memcpy(&v, field, sizeof(v)); ret.Set(v); break; }
+	case DA_UInt32: { uint32_t v; memcpy(&v, field, sizeof(v)); ret.Set(v); break; }
+	case DA_Int64: { int64_t v; memcpy(&v, field, sizeof(v)); ret.Set((double)v); break; }
+	case DA_Float: { float v; memcpy(&v, field, sizeof(v)); ret.Set((double)v); break; }
+	case DA_Double: { double v; memcpy(&v, field, sizeof(v)); ret.Set(v); break; }
+	default: ret.SetUndefined(); break;
+	}
+}
+
+void ObjectTemplateProxy::DirectAccessorSetter(Local<Name> property, Local<Value> value, const PropertyCallbackInfo<void>& info)
+{
+	DirectAccessorType type;
+	auto field = _GetDirectAccessorField(info.Holder(), info.Data().As<Int32>()->Value(), type);
+	if (field == nullptr) return;
+
+	if (type == DA_Boolean)
+	{
+		*field = value->BooleanValue(info.GetIsolate()) ? 1 : 0;
+		return;
+	}
+
+	auto context = info.GetIsolate()->GetCurrentContext();
+
+	// ... the integer types wrap the same way typed arrays do (NaN and infinity become 0); plain C++ casts are undefined for
+	// values that do not fit, so only the conversions V8 provides are used ...
+
+	switch (type)
+	{
+	case DA_Byte:
+	case DA_Int16:
+	case DA_UInt16:
+	case DA_Int32:
+	{
+		int32_t v;
+		if (!value->Int32Value(context).To(&v)) return; // (an exception was thrown converting the value)
+		if (type == DA_Byte) *field = (byte)v;
+		else if (type == DA_Int16) { auto v16 = (int16_t)v; memcpy(field, &v16, sizeof(v16)); }
+		else if (type == DA_UInt16) { auto v16 = (uint16_t)v; memcpy(field, &v16, sizeof(v16)); }
+		else memcpy(field, &v, sizeof(v));
+		return;
+	}
+	case DA_UInt32:
+	{
+		uint32_t v;
+		if (!value->Uint32Value(context).To(&v)) return;
+		memcpy(field, &v, sizeof(v));
+		return;
+	}
+	default: break;
+	}
+
+	double n;
+	if (value->IsNumber())
+		n = value.As<Number>()->Value();
+	else if (!value->NumberValue(context).To(&n))
+		return;
+
+	switch (type)
+	{
+	case DA_Int64:
+	{
+		// ... clamped, since the range of a double is much larger (2^63 is exactly representable as a double) ...
+		int64_t v;
+		if (std::isnan(n)) v = 0;
+		else if (n >= 9223372036854775808.0) v = std::numeric_limits<int64_t>::max();
+		else if (n <= -9223372036854775808.0) v = std::numeric_limits<int64_t>::min();
+		else v = (int64_t)n;
+		memcpy(field, &v, sizeof(v));
+		break;
+	}
+	case DA_Float:
+	{
+		// ... finite values past the range of a float become infinity, as they would in a 'Float32Array' ...
+		float v;
+		if (n > std::numeric_limits<float>::max()) v = std::numeric_limits<float>::infinity();
+		else if (n < -std::numeric_limits<float>::max()) v = -std::numeric_limits<float>::infinity();
+		else v = (float)n;
+		memcpy(field, &v, sizeof(v));
+		break;
+	}
+	case DA_Double: memcpy(field, &n, sizeof(n)); break;
+	default: break;
+	}
+}
+
+void ObjectTemplateProxy::SetDirectAccessor(const uint16_t *name, int32_t offset, DirectAccessorType type, v8::PropertyAttribute attributes)
+{
+	// ... the offset and type are packed into a small integer, so no allocation is needed to read them in the callbacks ...
+
+	auto data = NewInteger((offset << 4) | (int32_t)type);
+	auto setter = (attributes & ReadOnly) != 0 ? nullptr : DirectAccessorSetter;
+	_ObjectTemplate->SetAccessor(NewUString(name), DirectAccessorGetter, setter, data, DEFAULT, attributes);
+}
+
+// ------------------------------------------------------------------------------------------------------------------------
+
 void ObjectTemplateProxy::Set(const uint16_t *name, HandleProxy *value, v8::PropertyAttribute attributes)
 {
 	if (value != nullptr)
@@ -0,0 +1,190 @@
+#include "ProxyTypes.h"
+
+// ------------------------------------------------------------------------------------------------------------------------
+
+std::mutex ProxyPlatform::_InstanceMutex;
+ProxyPlatform* ProxyPlatform::_Instance = nullptr;
+PlatformOptions ProxyPlatform::_Options = { 0, 0, 0 };
+
+// ------------------------------------------------------------------------------------------------------------------------
+
+ProxyPlatform::ProxyPlatform(const PlatformOptions &options)
+	: _Terminating(false), _RunningTasks(0), _CompletedTasks(0), _StartedTasks(0), _TotalLatency(0), _MaxLatency(0)
+{
+	// ... the default platform only handles the foreground tasks here, so it gets the smallest worker pool possible (0 would size it by the processor count) ...
+	_DefaultPlatform = v8::platform::NewDefaultPlatform(1);
+
+	auto workerCount = options.WorkerCount;
+
+	if (workerCount <= 0)
+	{
+		workerCount = (int32_t)std::thread::hardware_concurrency() - 1; // (the same default V8 uses)
+		if (workerCount > 8) workerCount = 8;
+		if (workerCount < 1) workerCount = 1;
+	}
+
+	for (int32_t i = 0; i < workerCount; i++)
+		_Workers.push_back(std::thread(&ProxyPlatform::_RunWorker, this));
+}
+
+ProxyPlatform::~ProxyPlatform()
+{
+	{
+		lock_guard<std::mutex> lock(_Mutex);
+		_Terminating = true;
+	}
+	_TaskAvailable.notify_all();
+
+	for (size_t i = 0; i < _Workers.size(); i++)
+		_Workers[i].join();
+}
+
+// ------------------------------------------------------------------------------------------------------------------------
+
+bool ProxyPlatform::Configure(const PlatformOptions &options)
+{
+	lock_guard<std::mutex> lock(_InstanceMutex);
+	if (_Instance != nullptr) return false;
+	_Options = options;
+	return true;
+}
+
+ProxyPlatform* ProxyPlatform::GetInstance()
+{
+	lock_guard<std::mutex> lock(_InstanceMutex);
+	if (_Instance == nullptr)
+		_Instance = new ProxyPlatform(_Options);
+	return _Instance;
+}
+
+void ProxyPlatform::GetStats(PlatformStats &stats)
+{
+	memset(&stats, 0, sizeof(stats));
+
+	lock_guard<std::mutex> instanceLock(_InstanceMutex);
+	if (_Instance == nullptr) return;
+
+	lock_guard<std::mutex> lock(_Instance->_Mutex);
+
+	stats.WorkerCount = (int32_t)_Instance->_Workers.size();
+	stats.RunningTasks = _Instance->_RunningTasks;
+	for (auto i = 0; i < PTP_Count; i++)
+		stats.QueuedTasks += _Instance->_Queues[i].size();
+	stats.DelayedTasks = _Instance->_DelayedTasks.size();
+	stats.CompletedTasks = _Instance->_CompletedTasks;
+	stats.AverageLatency = _Instance->_StartedTasks > 0 ? _Instance->_TotalLatency / _Instance->_StartedTasks : 0;
+	stats.MaxLatency = _Instance->_MaxLatency;
+}
+
+// ------------------------------------------------------------------------------------------------------------------------
+
+void ProxyPlatform::_Post(PlatformTaskPriority priority, std::unique_ptr<Task> task)
+{
+	{
+		lock_guard<std::mutex> lock(_Mutex);
+		if (_Terminating) return; // (the task is deleted)
+		_QueuedTask queuedTask = { std::move(task), std::chrono::steady_clock::now() };
+		_Queues[priority].push_back(std::move(queuedTask));
+	}
+	_TaskAvailable.notify_one();
+}
+
+void ProxyPlatform::CallDelayedOnWorkerThread(std::unique_ptr<Task> task, double delay_in_seconds)
+{
+	{
+		lock_guard<std::mutex> lock(_Mutex);
+		if (_Terminating) return;
+		auto due = std::chrono::steady_clock::now() + std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(delay_in_seconds));
+		_QueuedTask queuedTask = { std::move(task), due };
+		_DelayedTasks.push_back(std::move(queuedTask));
+	}
+	_TaskAvailable.notify_one(); // (so a waiting worker can update the time it waits until)
+}
+
+// ------------------------------------------------------------------------------------------------------------------------
+
+void ProxyPlatform::_RunWorker()
+{
+#if _WIN32 || _WIN64
+	if (_Options.ThreadPriority != 0)
+		SetThreadPriority(GetCurrentThread(), _Options.ThreadPriority);
+	if (_Options.AffinityMask != 0)
+		SetThreadAffinityMask(GetCurrentThread(), (DWORD_PTR)_Options.AffinityMask);
+#endif
+
+	std::unique_lock<std::mutex> lock(_Mutex);
+
+	while (!_Terminating)
+	{
+		auto now = std::chrono::steady_clock::now();
+		auto nextDue = std::chrono::steady_clock::time_point::max();
+
+		// ... queue any delayed tasks that are now due ...
+
+		for (size_t i = 0; i < _DelayedTasks.size();)
+			if (_DelayedTasks[i].Time <= now)
+			{
+				_Queues[PTP_Normal].push_back(std::move(_DelayedTasks[i])); // (the latency is measured from when the task was due)
+				if (i + 1 < _DelayedTasks.size())
+					_DelayedTasks[i] = std::move(_DelayedTasks.back());
+				_DelayedTasks.pop_back();
+			}
+			else
+			{
+				if (_DelayedTasks[i].Time < nextDue) nextDue = _DelayedTasks[i].Time;
+				i++;
+			}
+
+		// ... take the next task with the highest priority ...
+
+		auto priority = 0;
+		while (priority < PTP_Count && _Queues[priority].empty())
+			priority++;
+
+		if (priority == PTP_Count)
+		{
+			if (nextDue == std::chrono::steady_clock::time_point::max())
+				_TaskAvailable.wait(lock);
+			else
+				_TaskAvailable.wait_until(lock, nextDue);
+			continue;
+		}
+
+		auto task = std::move(_Queues[priority].front().Item);
+		auto latency = std::chrono::duration<double, std::milli>(now - _Queues[priority].front().Time).count();
+		_Queues[priority].pop_front();
+
+		if (latency < 0) latency = 0;
+		_TotalLatency += latency;
+		if (latency > _MaxLatency) _MaxLatency = latency;
+		_StartedTasks++;
+		_RunningTasks++;
+
+		lock.unlock();
+		task->Run();
+		task.reset(); // (deleting a task can run more code, so this is done outside the lock as well)
+		lock.lock();
+
+		_RunningTasks--;
+		_CompletedTasks++;
+	}
+}
+
+// ------------------------------------------------------------------------------------------------------------------------
+
+void ProxyPlatform::CallOnForegroundThread(v8::Isolate* isolate, Task* task)
+{
+	_DefaultPlatform->GetForegroundTaskRunner(isolate)->PostTask(std::unique_ptr<Task>(task));
+}
+
+void ProxyPlatform::CallDelayedOnForegroundThread(v8::Isolate* isolate, Task* task, double delay_in_seconds)
+{
+	_DefaultPlatform->GetForegroundTaskRunner(isolate)->PostDelayedTask(std::unique_ptr<Task>(task), delay_in_seconds);
+}
+
+void ProxyPlatform::CallIdleOnForegroundThread(v8::Isolate* isolate, IdleTask* task)
+{
+	_DefaultPlatform->GetForegroundTaskRunner(isolate)->PostIdleTask(std::unique_ptr<IdleTask>(task));
+}
+
+// ------------------------------------------------------------------------------------------------------------------------
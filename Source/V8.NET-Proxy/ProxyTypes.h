@@ -3,8 +3,18 @@
 
 #include <exception>
 #include <vector>
+#include <map>
+#include <limits>
+#include <cmath>
+#include <set>
+#include <string>
 #if (_MSC_PLATFORM_TOOLSET >= 110)
 #include <mutex>
+#include <atomic>
+#include <thread>
+#include <condition_variable>
+#include <chrono>
+#include <deque>
 #endif
 
 #include <stdio.h>
@@ -32,6 +42,7 @@
 #else
 #include <glib.h>
 #define ALLOC_MANAGED_MEM(size) g_malloc(size)
+#define REALLOC_MANAGED_MEM(ptr, size) g_realloc(ptr, size)
 #define FREE_MANAGED_MEM(ptr) g_free(ptr)
 #define STDCALL __stdcall
 #endif
@@ -124,6 +135,7 @@ template <class T> struct CopyablePersistent {
 #define NewSizedUString(str, len) String::NewFromTwoByte(Isolate::GetCurrent(), str, String::kNormalString, len)
 #define NewUString(str) String::NewFromTwoByte(Isolate::GetCurrent(), str, String::kNormalString)
 #define NewName(str) NewUString(str)
+#define NewInternalizedUString(str) String::NewFromTwoByte(Isolate::GetCurrent(), str, NewStringType::kInternalized).ToLocalChecked()
 #define NewSizedString(str, len) String::NewFromUtf8(Isolate::GetCurrent(), str, String::kNormalString, len)
 #define NewString(str) String::NewFromUtf8(Isolate::GetCurrent(), str, String::kNormalString)
 #define NewPrivateString(str) Private::New(Isolate::GetCurrent(), NewString(str))
@@ -145,21 +157,21 @@ template <class T> struct CopyablePersistent {
 //    __lockScope; \
 //}
 
+// (see 'EngineIsolateScope' and 'EngineContextScope' for details on the locking and entering done by these scopes)
+
 #define BEGIN_ISOLATE_SCOPE(engine) \
 { \
-    v8::Locker __lockScope(engine->Isolate()); \
-    v8::Isolate::Scope __isolateScope(engine->Isolate()); \
-    v8::HandleScope __handleScope(Isolate::GetCurrent());
+    EngineIsolateScope __lockScope(engine); \
+    v8::HandleScope __handleScope(engine->Isolate());
 
 #define END_ISOLATE_SCOPE \
     __handleScope; \
-    __isolateScope; \
     __lockScope; \
 }
 
 #define BEGIN_CONTEXT_SCOPE(engine) \
 { \
-    v8::Context::Scope __contextScope(engine->Context());
+    EngineContextScope __contextScope(engine);
 
 #define END_CONTEXT_SCOPE \
     __contextScope; \
@@ -171,9 +183,11 @@ class ProxyBase;
 class ObjectTemplateProxy;
 class FunctionTemplateProxy;
 class V8EngineProxy;
+class EngineSession;
 
 struct HandleProxy;
 struct HandleValue;
+class ScriptError;
 
 // Get rid of some linker warnings regarding certain V8 object references.
 // (see https://groups.google.com/forum/?fromgroups=#!topic/v8-users/OuZPd0n-oRg)
@@ -208,6 +222,19 @@ enum  TProxyObjectType
 
 // ========================================================================================================================
 
+// Well known private keys (symbols) used by the proxy to tag objects.  These are created once per engine and cached (see
+// 'V8EngineProxy::GetPrivateKey()').
+enum PrivateKeyID
+{
+	PK_ManagedObjectID, // The ID of the managed object associated with a non-template object.
+	PK_CLRTypeID, // The CLR type ID for objects that represent strongly typed values (see 'SetCLRTypeID()').
+	PK_Dataset, // Set on the array buffers of dataset columns, and on the row view and row objects, to keep the dataset alive while any of them are still referenced (see 'Dataset').
+
+	PK_Count // (the number of well known keys; must be last)
+};
+
+// ========================================================================================================================
+
 #pragma pack(push, 1)
 // The proxy base class helps to identify objects when references are passed between native and managed mode.
 class ProxyBase
@@ -253,6 +280,18 @@ enum JSValueType : int32_t
 };
 //??#pragma enum(pop)
 
+// The individual parts of a script error that can be requested via 'GetErrorField()'.
+enum ScriptErrorField : int32_t
+{
+	SEF_Message, // The error message (without any location details).
+	SEF_ScriptName, // The resource name of the script the error occurred in.
+	SEF_SourceLine, // The line of source code the error occurred on.
+	SEF_Stack, // The stack trace (without the leading error message), if any.
+	SEF_Exception, // The exception value that was thrown.
+
+	// (when updating, don't forget to update V8EngineProxy.Enums.cs also!)
+};
+
 // ========================================================================================================================
 
 #pragma pack(push, 1)
@@ -282,6 +321,32 @@ struct HandleValue
 
 // ========================================================================================================================
 
+#pragma pack(push, 1)
+// A value passed by value between the managed and native sides, which allows bulk operations to avoid creating a 'HandleProxy' for every value.
+// Undefined, null, boolean, number, string, and date values are stored directly.  For any other value, 'Handle' references a handle proxy for it
+// (the managed side passes all handles as 'JSV_Object').
+struct PrimitiveValue
+{
+	JSValueType Type; // Note: a 32-bit type value (the managed code will expect 4 bytes).
+
+	union
+	{
+		bool V8Boolean;
+		int64_t V8Integer; // (32-bit integer, but 64-bit to keep the union size consistent)
+		double V8Number; // (also the milliseconds since epoch for dates)
+	};
+
+	union
+	{
+		uint16_t *V8String; // (strings returned to the managed side are allocated using 'ALLOC_MANAGED_MEM()' and freed by calling 'FreePrimitiveValues()')
+		HandleProxy *Handle; // (for non-primitive values; returned handles must be disposed by the managed side as usual)
+		int64_t _Pointer; // (to keep pointer sizes consistent between 32 and 64 bit systems)
+	};
+};
+#pragma pack(pop)
+
+// ========================================================================================================================
+
 #pragma pack(push, 1)
 // Provides a mechanism by which to keep track of V8 objects associated with managed side objects.
 struct HandleProxy : ProxyBase // TODO: Make a separate VALUE based handle proxy and use this for templates also.
@@ -306,6 +371,14 @@ private:
 
 	int32_t _EngineID;
 
+	// 1 if '_Value' already holds the value, so the managed side doesn't need to call 'UpdateValue()'.  This is only set for values that can never
+	// change (undefined, null, booleans, numbers, and strings); primitive values other than strings are read as soon as the handle is set.
+	int32_t _ValueIsCurrent;
+
+	// Incremented each time the handle is disposed, so anything that recorded the handle's ID (such as a command buffer) can tell when the ID
+	// was reused for another value.
+	int32_t _Generation;
+
 	union
 	{
 		V8EngineProxy* _EngineProxy;
@@ -315,6 +388,8 @@ private:
 	CopyablePersistent<Value> _Handle; // Reference to a JavaScript object (persisted handle for future reference - WARNING: Must be explicitly released when no longer needed!).
 	CopyablePersistent<v8::Script> _Script; // (references a script handle [instead of a value one])
 
+	ScriptError* _Error; // (details for error handles created from a caught script exception; the error text is only formatted when 'UpdateValue()' is called)
+
 	//static void _DisposeCallback(const WeakCallbackInfo<HandleProxy>& data);
 	static void _RevivableCallback(const WeakCallbackInfo<HandleProxy>& data);
 
@@ -334,10 +409,14 @@ protected:
 public:
 
 	int32_t SetManagedObjectID(int32_t id);
+	// Tags the object this handle represents as a CLR type info object with the given type ID (the managed side creates these when a script requests a strongly typed value).
+	bool SetCLRTypeID(int32_t typeID);
 	int GetManagedObjectID();
 	static int GetManagedObjectID(v8::Handle<Value> h);
 
 	bool IsError() { return _Type < 0; }
+	ScriptError* GetScriptError() { return _Error; } // (null if this handle was not created from a caught script exception)
+	Local<String> GetErrorText(); // (for error handles; returns the full error text to rethrow in script)
 
 	bool IsScript() { return _Type == JSV_Script; }
 
@@ -368,6 +447,7 @@ public:
 
 	V8EngineProxy* EngineProxy(); // Returns the associated engine, or null if the engine was disposed.
 	int32_t EngineID() { return _EngineID; }
+	int32_t Generation() { return _Generation; }
 
 	Local<Value> Handle();
 	Local<Script> Script();
@@ -375,7 +455,17 @@ public:
 	void MakeWeak();
 	void MakeStrong();
 
+	// Updates '_Value' with the current value of the handle.  Dates only get their numeric value, and objects get no value;
+	// call 'UpdateValueText()' to also render the text for those.
 	void UpdateValue();
+	void UpdateValueText();
+
+	// Returns the length (in UTF16 characters) of the string this handle represents, or -1 if the handle is not a string.
+	int32_t GetStringLength();
+	// Copies a range of the string this handle represents into a caller-supplied buffer (no null terminator is written).
+	// Returns the number of characters copied, or -1 if the handle is not a string.  This allows very large strings to be
+	// streamed in chunks instead of being copied all at once by 'UpdateValue()'.
+	int32_t ReadString(uint16_t* buffer, int32_t start, int32_t length);
 
 	friend V8EngineProxy;
 	friend ObjectTemplateProxy;
@@ -385,6 +475,50 @@ public:
 
 // ========================================================================================================================
 
+// Holds the details of a caught script exception.  Only the message and exception are kept; the location, script name and
+// stack are read from them when requested, and the full error text is only formatted when the managed side asks for it.
+class ScriptError
+{
+	V8EngineProxy* _EngineProxy;
+	CopyablePersistent<Message> _Message;
+	CopyablePersistent<Value> _Exception;
+	bool _Terminated;
+
+	bool _GetStack(Local<String> &stackStr, int32_t &start);
+
+public:
+
+	ScriptError(V8EngineProxy* engineProxy, TryCatch &tryCatch);
+	~ScriptError();
+
+	bool HasMessage() { return !_Message.IsEmpty(); }
+	bool WasTerminated() { return _Terminated; }
+
+	Local<String> MessageText(); // (empty string if there is no message)
+	int32_t LineNumber(); // (-1 if not known)
+	int32_t StartColumn(); // (-1 if not known)
+	Local<Value> ScriptName();
+	Local<Value> SourceLine();
+	Local<Value> Exception();
+	Local<Value> Stack(); // (the stack with any repeated exception message at the start removed, or an empty handle if there's no stack)
+
+	// Returns the requested part of the error, or an empty handle if not available.
+	Local<Value> GetField(ScriptErrorField field);
+
+	// Formats the message, location, and stack into a single string allocated with 'ALLOC_MANAGED_MEM()'.
+	uint16_t* FormatErrorText();
+};
+
+// ========================================================================================================================
+
+// Flags the managed side can set in 'ManagedAccessorInfo::ResultFlags' before returning from a callback.
+// (when updating, don't forget to update the managed side also!)
+enum ManagedAccessorResultFlags : int32_t
+{
+	MARF_None = 0,
+	MARF_Cacheable = 1 // (named property getters only: the value can be cached on the native side until invalidated [see 'InvalidatePropertyCache()'])
+};
+
 /**
 * Usually allocated on the stack before being passed to a managed call-back when triggered by script access.
 */
@@ -399,29 +533,31 @@ private:
 
 public:
 
+	int32_t ResultFlags; // (see 'ManagedAccessorResultFlags'; set by the managed side)
+
 	Local<Value> Data;
 	Local<Object> This;
 
 	ManagedAccessorInfo(ObjectTemplateProxy* objectProxy, int32_t managedObjectID, const PropertyCallbackInfo<Value>& info)
-		: _ObjectProxy(objectProxy), _ObjectID(managedObjectID)
+		: _ObjectProxy(objectProxy), _ObjectID(managedObjectID), ResultFlags(MARF_None)
 	{
 		Data = info.Data();
 		This = info.This();
 	}
 	ManagedAccessorInfo(ObjectTemplateProxy* objectProxy, int32_t managedObjectID, const PropertyCallbackInfo<Integer>& info)
-		: _ObjectProxy(objectProxy), _ObjectID(managedObjectID)
+		: _ObjectProxy(objectProxy), _ObjectID(managedObjectID), ResultFlags(MARF_None)
 	{
 		Data = info.Data();
 		This = info.This();
 	}
 	ManagedAccessorInfo(ObjectTemplateProxy* objectProxy, int32_t managedObjectID, const PropertyCallbackInfo<Boolean>& info)
-		: _ObjectProxy(objectProxy), _ObjectID(managedObjectID)
+		: _ObjectProxy(objectProxy), _ObjectID(managedObjectID), ResultFlags(MARF_None)
 	{
 		Data = info.Data();
 		This = info.This();
 	}
 	ManagedAccessorInfo(ObjectTemplateProxy* objectProxy, int32_t managedObjectID, const PropertyCallbackInfo<Array>& info)
-		: _ObjectProxy(objectProxy), _ObjectID(managedObjectID)
+		: _ObjectProxy(objectProxy), _ObjectID(managedObjectID), ResultFlags(MARF_None)
 	{
 		Data = info.Data();
 		This = info.This();
@@ -520,9 +656,50 @@ typedef bool (STDCALL *ManagedV8GarbageCollectionRequestCallback)(HandleProxy *h
 // ------------------------------------------------------------------------------------------------------------------------
 
 typedef HandleProxy* (STDCALL *ManagedJSFunctionCallback)(int32_t managedObjectID, bool isConstructCall, HandleProxy *_this, HandleProxy** args, uint32_t argCount);
+struct CallbackArguments;
+typedef HandleProxy* (STDCALL *ManagedJSFunctionArgsCallback)(int32_t managedObjectID, bool isConstructCall, CallbackArguments *args, int32_t argCount);
+
+// ------------------------------------------------------------------------------------------------------------------------
+
+// Receives text output in chunks (UTF-16 characters, or UTF-8 bytes, depending on the request; 'length' is in those units).
+// Return false to stop writing.
+typedef bool (STDCALL *ManagedWriteCallback)(const void* data, int32_t length);
+
+// Called when V8 no longer references an array buffer created over memory owned by the managed side (see 'CreateExternalArrayBuffer()'), or when
+// the engine is disposed. 'releaseID' is the value given when the buffer was created.
+// Note: This may be called during garbage collection, so the engine must NOT be accessed in the callback.
+typedef void (STDCALL *ManagedReleaseCallback)(void* data, int64_t length, int32_t releaseID);
 
 // ========================================================================================================================
 
+// The value types of direct accessors, which read and write memory directly (see 'ObjectTemplateProxy::SetDirectAccessor()').
+// (when updating, don't forget to update the managed side also!)
+enum DirectAccessorType : int32_t
+{
+	DA_Boolean, // (1 byte; 0 is false)
+	DA_Byte,
+	DA_Int16,
+	DA_UInt16,
+	DA_Int32,
+	DA_UInt32,
+	DA_Int64, // (read as a number, so values past 2^53 lose precision)
+	DA_Float,
+	DA_Double,
+
+	DA_Count // (must be last; must be 16 or less [see 'SetDirectAccessor()'])
+};
+
+// The internal fields of objects created from object templates.
+enum TemplateObjectField
+{
+	TOF_TemplateProxy, // (aligned pointer to the associated proxy)
+	TOF_ManagedObjectID, // (the associated managed object ID [as an External])
+	TOF_DataPointer, // (aligned pointer to the memory read by direct accessors; see 'SetObjectDataPointer()')
+	TOF_PropertyCache, // (a map of property values cached from the managed named property getter; created on first use)
+	TOF_PropertyCacheVersion, // (the engine's property cache version when the cache was last validated [see 'V8EngineProxy::InvalidatePropertyCaches()'])
+	TOF_Count
+};
+
 /**
   * A proxy class to encapsulate the call-back methods needed to resolve properties for representing a managed object.
   */
@@ -598,12 +775,24 @@ public:
 	static void AccessorGetterCallbackProxy(Local<Name> property, const PropertyCallbackInfo<Value>& info);
 	static void AccessorSetterCallbackProxy(Local<Name> property, Local<Value> value, const PropertyCallbackInfo<void>& info);
 
+	// Returns the cache of property values for an object created from a template (see 'ManagedAccessorResultFlags'), or an empty handle if the object
+	// has no cache (and 'create' is false) or cannot have one.  The cache is cleared first if the engine's cache version has changed.
+	static Local<v8::Map> GetPropertyCache(V8EngineProxy* engine, const Local<Object> &obj, bool create);
+
+	static void DirectAccessorGetter(Local<Name> property, const PropertyCallbackInfo<Value>& info);
+	static void DirectAccessorSetter(Local<Name> property, Local<Value> value, const PropertyCallbackInfo<void>& info);
+
 	HandleProxy* CreateObject(int32_t managedObjectID);
 
 	void SetAccessor(int32_t managedObjectID, const uint16_t *name,
 		ManagedAccessorGetter getter, ManagedAccessorSetter setter,
 		v8::AccessControl access, v8::PropertyAttribute attributes);
 
+	// Creates a property that reads and writes a value in memory directly, without calling back into the managed side.  The value is at 'offset'
+	// bytes from the data pointer of the object (see 'SetObjectDataPointer()'); if an object has no data pointer, the property is undefined.  If
+	// 'attributes' includes 'ReadOnly', writes are ignored.
+	void SetDirectAccessor(const uint16_t *name, int32_t offset, DirectAccessorType type, v8::PropertyAttribute attributes);
+
 	void Set(const uint16_t *name, HandleProxy *value, v8::PropertyAttribute attributes);
 
 	friend V8EngineProxy;
@@ -613,6 +802,122 @@ public:
 
 // ========================================================================================================================
 
+#pragma pack(push, 1)
+// Counters for the argument buffers used when calling between JavaScript and the managed side (see 'ArgumentBuffer').
+// (when updating, don't forget to update the managed side also!)
+struct ArgumentBufferStats
+{
+	int64_t InlineUses; // Argument lists that fit in the inline (stack) storage.
+	int64_t ArenaUses; // Larger argument lists taken from the engine's argument arena.
+	int64_t HeapAllocations; // Blocks the arena had to allocate (this stays the same once the arena has grown to fit the largest calls).
+};
+#pragma pack(pop)
+
+// A per-engine stack of reusable memory blocks for argument lists too large for inline storage.  Memory is released in the reverse order it was
+// taken (nested calls between JavaScript and the managed side always unwind that way), so blocks are only allocated while the arena grows.
+class ArgumentArena
+{
+	struct Block { byte* Data; size_t Size; };
+
+	vector<Block> _Blocks;
+	size_t _Block; // (the block currently allocated from)
+	size_t _Offset; // (the next free byte in the current block)
+
+public:
+
+	struct Mark { size_t Block, Offset; }; // (the arena position before an allocation; restore it to release the allocation)
+
+	ArgumentBufferStats Stats;
+
+	ArgumentArena() : _Block(0), _Offset(0), Stats() {}
+	~ArgumentArena();
+
+	void* Allocate(size_t size, Mark &mark);
+	void Release(const Mark &mark) { _Block = mark.Block; _Offset = mark.Offset; }
+};
+
+#define ARGUMENT_BUFFER_INLINE_COUNT 8
+
+// A list of call arguments with inline storage for the common case of 'ARGUMENT_BUFFER_INLINE_COUNT' or fewer, and arena storage for more (see
+// 'ArgumentArena').  Only create these on the stack.
+template <typename T>
+class ArgumentBuffer
+{
+	T _Inline[ARGUMENT_BUFFER_INLINE_COUNT];
+	T* _Items;
+	ArgumentArena* _Arena; // (only set if the arena was used)
+	ArgumentArena::Mark _Mark;
+
+	ArgumentBuffer(const ArgumentBuffer&) = delete;
+	ArgumentBuffer& operator=(const ArgumentBuffer&) = delete;
+
+public:
+
+	ArgumentBuffer(ArgumentArena &arena, int32_t count) : _Items(_Inline), _Arena(nullptr)
+	{
+		if (count <= ARGUMENT_BUFFER_INLINE_COUNT)
+			arena.Stats.InlineUses++;
+		else
+		{
+			_Items = (T*)arena.Allocate(sizeof(T) * count, _Mark);
+			for (auto i = 0; i < count; i++)
+				new (&_Items[i]) T(); // (only trivially destructible types are used, so there's no matching destructor call)
+			_Arena = &arena;
+			arena.Stats.ArenaUses++;
+		}
+	}
+
+	~ArgumentBuffer() { if (_Arena != nullptr) _Arena->Release(_Mark); }
+
+	T* Items() { return _Items; }
+	T& operator[](int32_t i) { return _Items[i]; }
+};
+
+// ========================================================================================================================
+
+// The C signatures supported for primitive callbacks on function templates (see 'FunctionTemplateProxy::SetPrimitiveCallback()').
+// (when updating, don't forget to update the managed side also!)
+enum PrimitiveSignature : int32_t
+{
+	PS_None, // (no primitive callback; all calls go through the managed callback)
+	PS_Number1, // double (double)
+	PS_Number2, // double (double, double)
+	PS_Int32_1, // int32_t (int32_t)
+	PS_Int32_2, // int32_t (int32_t, int32_t)
+	PS_NumberArray, // double (const double* args, int32_t argCount) (any number of arguments, up to 'PRIMITIVE_CALLBACK_MAX_ARGS')
+	PS_Count
+};
+
+#define PRIMITIVE_CALLBACK_MAX_ARGS 16
+
+typedef double (STDCALL *PrimitiveNumber1Callback)(double a);
+typedef double (STDCALL *PrimitiveNumber2Callback)(double a, double b);
+typedef int32_t (STDCALL *PrimitiveInt32_1Callback)(int32_t a);
+typedef int32_t (STDCALL *PrimitiveInt32_2Callback)(int32_t a, int32_t b);
+typedef double (STDCALL *PrimitiveNumberArrayCallback)(const double* args, int32_t argCount);
+
+// A view over the arguments of a function call, given to managed callbacks set using 'FunctionTemplateProxy::SetManagedArgsCallback()'.  Handle
+// proxies are only created for the arguments (and 'this') the managed side asks for, and primitive values can be read without any handles at
+// all.  The view is allocated on the stack, so it is only valid during the call; any handle proxies it created are disposed when it goes away.
+struct CallbackArguments
+{
+	V8EngineProxy* Engine;
+	const FunctionCallbackInfo<Value>* Info;
+
+	CallbackArguments(V8EngineProxy* engine, const FunctionCallbackInfo<Value>& info);
+	~CallbackArguments();
+
+	int32_t Length() { return Info->Length(); }
+
+	HandleProxy* This(); // Returns a handle proxy for 'this' (created on first request).
+	HandleProxy* Argument(int32_t index); // Returns a handle proxy for an argument (created on first request), or null if the index is out of range.
+	void GetValue(int32_t index, PrimitiveValue &value); // Reads an argument as a tagged value (handles are only used for non-primitive values, and are owned by the view).
+
+private:
+	HandleProxy* _This;
+	ArgumentBuffer<HandleProxy*> _Args; // (null entries have not been requested yet)
+};
+
 /**
 * A proxy class to encapsulate the call-back methods needed to resolve properties for representing a managed object.
 */
@@ -629,6 +934,14 @@ protected:
 
 	ManagedJSFunctionCallback _ManagedCallback;
 
+	ManagedJSFunctionArgsCallback _ManagedArgsCallback; // (if set, this is used instead of '_ManagedCallback')
+
+	PrimitiveSignature _PrimitiveSignature;
+	void* _PrimitiveCallback; // (a function pointer of the type given by '_PrimitiveSignature')
+
+	bool _InvokePrimitiveCallback(const FunctionCallbackInfo<Value>& args);
+	static void _InvokeArgsCallback(V8EngineProxy* engine, ManagedJSFunctionArgsCallback callback, const FunctionCallbackInfo<Value>& args);
+
 public:
 
 	FunctionTemplateProxy(V8EngineProxy* engineProxy, uint16_t* className, ManagedJSFunctionCallback managedCallback = nullptr);
@@ -639,6 +952,14 @@ public:
 
 	void SetManagedCallback(ManagedJSFunctionCallback managedCallback);
 
+	// Sets a managed callback that receives a 'CallbackArguments' view instead of a handle proxy for every argument.  Pass null to go back to
+	// using the regular managed callback.
+	void SetManagedArgsCallback(ManagedJSFunctionArgsCallback managedCallback);
+
+	// Sets a typed callback that is called directly with the primitive argument values (no handle proxies are created).  If the arguments
+	// given by a script don't match the signature (or for construct calls), the managed callback is used instead.
+	void SetPrimitiveCallback(PrimitiveSignature signature, void* callback);
+
 	static void InvocationCallbackProxy(const FunctionCallbackInfo<Value>& args);
 
 	ObjectTemplateProxy* GetInstanceTemplateProxy();
@@ -707,6 +1028,333 @@ public:
 
 // ========================================================================================================================
 
+// The element types supported when creating typed array views over array buffers.
+// (when updating, don't forget to update the managed side also!)
+enum TypedArrayType : int32_t
+{
+	TA_Int8,
+	TA_Uint8,
+	TA_Uint8Clamped,
+	TA_Int16,
+	TA_Uint16,
+	TA_Int32,
+	TA_Uint32,
+	TA_Float32,
+	TA_Float64,
+	TA_DataView // (not a typed array, but also a view over an array buffer; the length is in bytes)
+};
+
+// Allocation statistics for the array buffer memory of an engine (see 'PooledArrayBufferAllocator').
+// (when updating, don't forget to update the managed side also!)
+struct ArrayBufferAllocatorStats
+{
+	int64_t AllocatedBytes; // The bytes currently allocated for array buffers (in the requested sizes, not including any pooling overhead).
+	int64_t PeakBytes; // The highest value 'AllocatedBytes' has reached.
+	int64_t PooledBytes; // The bytes held in the pool of freed blocks for reuse.
+	int64_t MaxBytes; // The limit for 'AllocatedBytes' (0 if there is no limit).
+	int64_t AllocationCount; // The number of successful allocations.
+	int64_t FailedAllocationCount; // The number of allocations refused because of the limit (or because the system ran out of memory).
+};
+
+// The array buffer allocator used by each engine.  Small blocks are rounded up to a power of two size class and are kept in a pool when freed
+// (up to a limit) so scripts that create many short-lived typed arrays don't go to the system allocator each time.  An optional limit on the
+// bytes allocated makes scripts that allocate too much get a 'RangeError' instead of exhausting the process.
+// Note: V8 may free array buffers on background threads, so all access is synchronized.
+class PooledArrayBufferAllocator : public ArrayBuffer::Allocator
+{
+public:
+
+	static const int32_t MinBlockSizeBits = 6; // (64 bytes)
+	static const int32_t MaxBlockSizeBits = 16; // (64 KB; larger blocks are never pooled)
+	static const int32_t SizeClassCount = MaxBlockSizeBits - MinBlockSizeBits + 1;
+
+private:
+
+	std::mutex _Mutex;
+	vector<void*> _FreeBlocks[SizeClassCount];
+	int64_t _MaxBytes;
+	int64_t _MaxPooledBytes;
+	ArrayBufferAllocatorStats _Stats;
+
+	static int32_t _GetSizeClass(size_t length);
+	void* _Allocate(size_t length, bool zeroFill);
+	void _TrimPool();
+
+public:
+
+	PooledArrayBufferAllocator();
+	~PooledArrayBufferAllocator();
+
+	virtual void* Allocate(size_t length) override { return _Allocate(length, true); }
+	virtual void* AllocateUninitialized(size_t length) override { return _Allocate(length, false); }
+	virtual void Free(void* data, size_t length) override;
+
+	// Sets the limit for the bytes allocated (0 for no limit), and the limit for the bytes kept in the pool (0 disables pooling).
+	void SetLimits(int64_t maxBytes, int64_t maxPooledBytes);
+	void GetStats(ArrayBufferAllocatorStats &stats);
+};
+
+// The managed callbacks for an accessor.  The accessor data is a single External referencing this, so dispatching a call is one pointer load
+// (see 'V8EngineProxy::CreateManagedAccessors()').  These are deleted once V8 no longer references the External, or when the engine is disposed.
+struct ManagedAccessors
+{
+	int32_t ManagedObjectID; // (-1 if not explicitly set)
+	ManagedAccessorGetter Getter;
+	ManagedAccessorSetter Setter;
+	CopyablePersistent<External> Data; // (weak)
+};
+
+// Tracks an array buffer created over external memory, so the owner can be told when the memory is no longer used by V8.
+struct ExternalArrayBuffer
+{
+	CopyablePersistent<ArrayBuffer> Buffer;
+	void* Data;
+	int64_t Length;
+	ManagedReleaseCallback ReleaseCallback;
+	int32_t ReleaseID;
+};
+
+// The field types of a registered object shape (see 'ObjectShape').  Fields are packed in order with no padding, using these sizes:
+//   SF_Boolean: 1 byte; SF_Int32: 4 bytes; SF_Number and SF_Date (ms since epoch): 8 bytes;
+//   SF_String (uint16_t*, null terminated) and SF_Handle (HandleProxy*): 8 bytes (the pointer is stored as a 64-bit value on all platforms).
+// (when updating, don't forget to update the managed side also!)
+enum ShapeFieldType : int32_t
+{
+	SF_Boolean,
+	SF_Int32,
+	SF_Number,
+	SF_Date,
+	SF_String,
+	SF_Handle // (any value; a handle proxy is created when extracting)
+};
+
+// A fixed schema for objects (an ordered list of property names and their expected types), so values can be moved between objects and packed
+// structs in a single call.  The property names are internalized once, and objects are created from a template that already has all the
+// properties, so all objects built from a shape share the same hidden class.
+class ObjectShape
+{
+	V8EngineProxy* _EngineProxy;
+	int32_t _ID;
+	CopyablePersistent<String>* _Names; // (an array, one per field)
+	vector<ShapeFieldType> _Types;
+	vector<int32_t> _Offsets;
+	int32_t _Size;
+	CopyablePersistent<ObjectTemplate> _Template;
+
+public:
+
+	ObjectShape(V8EngineProxy* engineProxy, int32_t id, const uint16_t** names, const ShapeFieldType* types, int32_t count);
+	~ObjectShape();
+
+	static int32_t GetFieldSize(ShapeFieldType type);
+
+	int32_t ID() { return _ID; }
+	int32_t Size() { return _Size; } // (the size of the packed struct in bytes)
+	int32_t FieldCount() { return (int32_t)_Types.size(); }
+
+	// Reads the shape's properties from an object into a packed struct.  Properties that don't have the expected type are stored as 0, NaN, or
+	// null.  Returns the number of properties that didn't match, or -1 if a getter threw an exception.
+	// Note: Any strings stored must be freed using 'FreeValues()'.
+	int32_t Extract(Local<Object> obj, byte* buffer);
+
+	// Creates an object from a packed struct.  Returns an empty handle if the object could not be created (any handles in the struct are
+	// still released).
+	MaybeLocal<Object> Create(const byte* buffer);
+
+	// Frees any strings in a packed struct filled in by 'Extract()'.
+	void FreeValues(byte* buffer);
+};
+
+// ========================================================================================================================
+
+// The column types of a dataset (see 'Dataset').
+// (when updating, don't forget to update the managed side also!)
+enum DatasetColumnType : int32_t
+{
+	DC_Number, // (double values; exposed as a Float64Array)
+	DC_Int32, // (int32_t values; exposed as an Int32Array)
+	DC_String // (int32_t indexes into the column's dictionary [-1 for null]; the indexes are exposed as an Int32Array)
+};
+
+#pragma pack(push, 1)
+// Describes one column of a dataset, as passed in from the managed side.
+struct DatasetColumnInfo
+{
+	const uint16_t* Name;
+	DatasetColumnType Type;
+	void* Data; // (one value per row; this memory is used directly, and must remain valid until the dataset is released)
+	const uint16_t** Dictionary; // (string columns only: the distinct strings [these are copied when the dataset is created])
+	int32_t DictionarySize;
+};
+#pragma pack(pop)
+
+// Exposes columnar data owned by the managed side to scripts without creating an object per row.  The dataset object has these properties:
+//   length: The number of rows.
+//   columns: An object with a typed array over the memory of each column (no copy is made).
+//   dictionaries: An object with an array of the distinct strings for each string column.
+//   rows: A lazy row view; 'rows[i]' returns a small object whose properties are read from the columns on demand (using native interceptors).
+// The dataset is released (and the managed side notified) once V8 no longer references the dataset object, its rows, or any of its columns.
+class Dataset
+{
+	struct _Column
+	{
+		CopyablePersistent<String> Name;
+		DatasetColumnType Type;
+		void* Data;
+		CopyablePersistent<String>* Dictionary;
+		int32_t DictionarySize;
+	};
+
+	V8EngineProxy* _EngineProxy;
+	int32_t _RowCount;
+	_Column* _Columns;
+	int32_t _ColumnCount;
+	CopyablePersistent<Object> _Object; // (weak; the dataset is released once this is collected)
+	ManagedReleaseCallback _ReleaseCallback;
+	int32_t _ReleaseID;
+
+	int32_t _FindColumn(Local<Name> name);
+
+	static void _GetRow(uint32_t index, const PropertyCallbackInfo<Value>& info);
+	static void _QueryRow(uint32_t index, const PropertyCallbackInfo<Integer>& info);
+	static void _EnumerateRows(const PropertyCallbackInfo<Array>& info);
+	static void _GetField(Local<Name> name, const PropertyCallbackInfo<Value>& info);
+	static void _QueryField(Local<Name> name, const PropertyCallbackInfo<Integer>& info);
+	static void _EnumerateFields(const PropertyCallbackInfo<Array>& info);
+	static void _WeakCallback(const WeakCallbackInfo<Dataset>& data);
+	static void _ReleaseCallback(const WeakCallbackInfo<Dataset>& data); // (second pass; the dataset is released here)
+
+public:
+
+	Dataset(V8EngineProxy* engineProxy, int32_t rowCount, const DatasetColumnInfo* columns, int32_t columnCount, ManagedReleaseCallback releaseCallback, int32_t releaseID);
+	~Dataset(); // (notifies the managed side that the memory is no longer used)
+
+	// The templates for the row view and row objects (created once per engine).
+	static Local<ObjectTemplate> CreateRowsTemplate();
+	static Local<ObjectTemplate> CreateRowTemplate();
+
+	// Creates the dataset object (see above).  Only call this once.  Returns an empty handle if the object could not be created.
+	MaybeLocal<Object> CreateObject();
+
+	// Returns the value of a column for a row (the column and row must be in range).
+	Local<Value> GetValue(int32_t column, int32_t row);
+};
+
+// ========================================================================================================================
+
+// Options for the process-wide platform (see 'ProxyPlatform').
+// (when updating, don't forget to update the managed side also!)
+struct PlatformOptions
+{
+	int32_t WorkerCount; // The number of worker threads for background tasks (0 to use the number of processors less one, up to 8).
+	int32_t ThreadPriority; // The OS priority of the worker threads (a Windows 'THREAD_PRIORITY_...' value; 0 is normal).
+	uint64_t AffinityMask; // The processors the worker threads may run on, one bit per processor (0 for any).
+};
+
+// Task statistics for the process-wide platform (see 'ProxyPlatform::GetStats()').
+// (when updating, don't forget to update the managed side also!)
+struct PlatformStats
+{
+	int32_t WorkerCount; // The number of worker threads (0 if the platform was not created yet).
+	int32_t RunningTasks; // The number of tasks running on the worker threads right now.
+	int64_t QueuedTasks; // The number of tasks waiting for a worker thread.
+	int64_t DelayedTasks; // The number of tasks waiting for their delay to expire (these are queued when they expire).
+	int64_t CompletedTasks; // The number of tasks that have finished running.
+	double AverageLatency; // The average time in milliseconds tasks have waited in the queue before they started running.
+	double MaxLatency; // The longest time in milliseconds a task has waited in the queue before it started running.
+};
+
+// The priorities of the background tasks posted by V8 (tasks with a higher priority always run first).
+enum PlatformTaskPriority : int32_t
+{
+	PTP_UserBlocking, // (tasks the script thread may be waiting on; see 'CallBlockingTaskOnWorkerThread()')
+	PTP_Normal,
+	PTP_BestEffort, // (see 'CallLowPriorityTaskOnWorkerThread()')
+	PTP_Count
+};
+
+// The V8 platform shared by all engines in the process.  Background tasks (compiling, garbage collection, etc.) are run on a bounded pool of
+// worker threads owned by this class, so the number of threads, their OS priority, and the processors they run on can be controlled (the
+// default platform sizes its pool by the processor count, which then competes with the host application's own threads).  Foreground tasks,
+// tracing, and page allocation are left to a default platform instance.
+// Note: V8 can only be initialized once per process, so the platform is created on first use and is never destroyed.
+class ProxyPlatform : public v8::Platform
+{
+	struct _QueuedTask
+	{
+		std::unique_ptr<Task> Item;
+		std::chrono::steady_clock::time_point Time; // (when the task was queued, or when it is due if it's a delayed task)
+	};
+
+	static std::mutex _InstanceMutex;
+	static ProxyPlatform* _Instance;
+	static PlatformOptions _Options;
+
+	std::unique_ptr<v8::Platform> _DefaultPlatform;
+	vector<std::thread> _Workers;
+
+	std::mutex _Mutex;
+	std::condition_variable _TaskAvailable;
+	std::deque<_QueuedTask> _Queues[PTP_Count];
+	vector<_QueuedTask> _DelayedTasks; // (not sorted; these are few, so the workers simply scan for the next one due)
+	bool _Terminating;
+
+	int32_t _RunningTasks;
+	int64_t _CompletedTasks;
+	int64_t _StartedTasks;
+	double _TotalLatency;
+	double _MaxLatency;
+
+	ProxyPlatform(const PlatformOptions &options);
+
+	void _Post(PlatformTaskPriority priority, std::unique_ptr<Task> task);
+	void _RunWorker();
+
+public:
+
+	~ProxyPlatform();
+
+	// Sets the options used when the platform is created.  Returns false if the platform was already created (the options are then ignored).
+	static bool Configure(const PlatformOptions &options);
+	// Returns the process-wide platform, creating it if needed.
+	static ProxyPlatform* GetInstance();
+	// Gets the task statistics (all zeros if the platform was not created yet).
+	static void GetStats(PlatformStats &stats);
+
+	virtual PageAllocator* GetPageAllocator() override { return _DefaultPlatform->GetPageAllocator(); }
+	virtual void OnCriticalMemoryPressure() override { _DefaultPlatform->OnCriticalMemoryPressure(); }
+	virtual bool OnCriticalMemoryPressure(size_t length) override { return _DefaultPlatform->OnCriticalMemoryPressure(length); }
+
+	virtual int NumberOfWorkerThreads() override { return (int)_Workers.size(); }
+	virtual void CallOnWorkerThread(std::unique_ptr<Task> task) override { _Post(PTP_Normal, std::move(task)); }
+	virtual void CallBlockingTaskOnWorkerThread(std::unique_ptr<Task> task) override { _Post(PTP_UserBlocking, std::move(task)); }
+	virtual void CallLowPriorityTaskOnWorkerThread(std::unique_ptr<Task> task) override { _Post(PTP_BestEffort, std::move(task)); }
+	virtual void CallDelayedOnWorkerThread(std::unique_ptr<Task> task, double delay_in_seconds) override;
+
+	virtual std::shared_ptr<v8::TaskRunner> GetForegroundTaskRunner(v8::Isolate* isolate) override { return _DefaultPlatform->GetForegroundTaskRunner(isolate); }
+	virtual void CallOnForegroundThread(v8::Isolate* isolate, Task* task) override;
+	virtual void CallDelayedOnForegroundThread(v8::Isolate* isolate, Task* task, double delay_in_seconds) override;
+	virtual void CallIdleOnForegroundThread(v8::Isolate* isolate, IdleTask* task) override;
+	virtual bool IdleTasksEnabled(v8::Isolate* isolate) override { return _DefaultPlatform->IdleTasksEnabled(isolate); }
+
+	virtual double MonotonicallyIncreasingTime() override { return _DefaultPlatform->MonotonicallyIncreasingTime(); }
+	virtual double CurrentClockTimeMillis() override { return _DefaultPlatform->CurrentClockTimeMillis(); }
+	virtual TracingController* GetTracingController() override { return _DefaultPlatform->GetTracingController(); }
+};
+
+// ========================================================================================================================
+
+// Flags for creating engines (see 'CreateV8EngineProxyEx()').
+// (when updating, don't forget to update the managed side also!)
+enum EngineFlags : int32_t
+{
+	EF_None = 0,
+	// The engine is owned by the thread that creates it.  The isolate is locked once when the engine is created (and the context entered
+	// once when it is set), so calls into the engine skip the 'v8::Locker' and context scope.  Only the owner thread may call into the
+	// engine (this is checked in debug builds), and handles disposed on other threads (i.e. by the managed GC) are queued instead.
+	EF_ThreadAffine = 1
+};
+
 class V8EngineProxy : ProxyBase
 {
 protected:
@@ -722,21 +1370,52 @@ protected:
 
 	int32_t _NextNonTemplateObjectID;
 
-	std::unique_ptr<v8::Platform> _Platform;
+	PooledArrayBufferAllocator* _ArrayBufferAllocator;
 	Isolate* _Isolate;
 	//?ObjectTemplateProxy* _GlobalObjectTemplateProxy; // (for working with the managed side regarding the global scope)
 	CopyablePersistent<v8::Context> _Context;
 	CopyablePersistent<v8::Object> _GlobalObject; // (taken from the context)
 	ManagedV8GarbageCollectionRequestCallback _ManagedV8GarbageCollectionRequestCallback;
 
+	CopyablePersistent<Private> _PrivateKeys[PK_Count]; // The well known private keys, created once when the engine is created.
+	std::map<std::string, CopyablePersistent<Private>> _CustomPrivateKeys; // Any other private keys, created once on first request.
+
 	vector<_StringItem> _Strings; // An array (cache) of string buffers to reuse when marshalling strings.
 
+	ArgumentArena _ArgumentArena; // Storage for large argument lists (see 'ArgumentBuffer').
+
+	vector<ObjectShape*> _Shapes; // The registered object shapes (by ID).
+
+	vector<CopyablePersistent<String>*> _CommandNames; // The property names registered for command buffers (by ID; see 'CommandInterpreter').
+
+	std::set<ExternalArrayBuffer*> _ExternalArrayBuffers; // Array buffers over external memory that are still referenced by V8 (released when the engine is disposed).
+
+	std::set<ManagedAccessors*> _ManagedAccessors; // Accessor callbacks that are still referenced by V8 (deleted when the engine is disposed).
+
+	static void _ManagedAccessorsWeakCallback(const WeakCallbackInfo<ManagedAccessors>& data);
+
+	std::set<Dataset*> _Datasets; // Datasets that are still referenced by V8 (released when the engine is disposed).
+	CopyablePersistent<ObjectTemplate> _DatasetRowsTemplate; // (created on first use)
+	CopyablePersistent<ObjectTemplate> _DatasetRowTemplate; // (created on first use)
+
+	void _ReleaseDataset(Dataset* dataset);
+
+	static void _ExternalArrayBufferWeakCallback(const WeakCallbackInfo<ExternalArrayBuffer>& data);
+	static void _ExternalArrayBufferReleaseCallback(const WeakCallbackInfo<ExternalArrayBuffer>& data); // (second pass; see above)
+	void _ReleaseExternalArrayBuffer(ExternalArrayBuffer* buffer);
+
 	vector<HandleProxy*> _Handles; // An array of all allocated handles for this engine proxy.
 	vector<HandleProxy*> _HandlesPendingDisposal; // An array of handles for this engine proxy that are ready to be disposed.
 	vector<int> _DisposedHandles; // An array of handles (by ID [index]) that have been disposed. The managed GC thread uses this, so beware!
 	std::mutex _DisposingHandleMutex; // A mutex used to prevent access to the handle disposal queue system as a "critical section".  NO ACCESS TO THE V8 ENGINE IS ALLOWED FOR MANAGED GARBAGE COLLECTION IN THIS CRITICAL SECTION.
 	recursive_mutex _HandleSystemMutex; // A mutex used to prevent access to the handle system as a "critical section".  NO ACCESS TO THE V8 ENGINE IS ALLOWED FOR MANAGED GARBAGE COLLECTION IN THIS CRITICAL SECTION.
 
+	vector<ObjectTemplateProxy*> _ObjectTemplatesPendingDeletion; // Templates finalized by the managed GC that must be deleted on a thread that can use the engine (guarded by '_DisposingHandleMutex').
+	vector<FunctionTemplateProxy*> _FunctionTemplatesPendingDeletion; // (same as above, for function templates)
+	std::atomic<int32_t> _TemplatesPendingDeletion; // The number of templates in both lists above (so they can be checked without taking the lock).
+
+	void _DeletePendingTemplates(); // (deletes the queued templates; the isolate must be entered)
+
 	vector<HandleProxy*> _HandlesToBeMadeWeak;
 	recursive_mutex _MakeWeakQueueMutex;
 	vector<HandleProxy*> _HandlesToBeMadeStrong;
@@ -744,19 +1423,52 @@ protected:
 
 	vector<HandleProxy*> _Objects; // An array of handle references by object ID. This allows pulling an already existing proxy handle for an object without having to allocate a new one.
 
+	int32_t _PropertyCacheVersion; // Incremented to invalidate all cached property values (see 'ObjectTemplateProxy::GetPropertyCache()').
+
 	bool _IsExecutingScript; // True if the engine is executing a script.  This is used abort entering a locker on idle notifications while scripts are running.
 	int _InCallbackScope; // >0 if currently in a scope that is/will call back to the manage side. This helps to notify when a callback to the managed side causes another call back into the engine.
 	bool _IsTerminatingScript; // True if the engine was asked to terminate a script.  This is used to detect when a script is aborted.
 
+	bool _ThreadAffine; // True if the engine was created with 'EF_ThreadAffine'.
+	std::thread::id _OwnerThread; // The thread that created the engine (only used with 'EF_ThreadAffine').
+	v8::Locker* _OwnerLocker; // The lock held by the owner thread for the life of the engine (only used with 'EF_ThreadAffine').
+	bool _ContextEntered; // True if the current context was entered once for the life of the engine (thread-affine engines only).
+
+	// (these are atomic because other threads [such as the managed GC] check them without the isolate lock)
+	std::atomic<EngineSession*> _Session; // The session opened by 'BeginSession()', if any.
+	std::atomic<std::thread::id> _SessionThread; // The thread that opened '_Session' (only that thread can use the session scopes).
+	int32_t _SessionDepth; // (the number of nested 'BeginSession()' calls)
+
 public:
 
 	Isolate* Isolate();
 	Handle<Context> Context();
 
-	V8EngineProxy(bool enableDebugging, DebugMessageDispatcher* debugMessageDispatcher, int debugPort);
+	V8EngineProxy(bool enableDebugging, DebugMessageDispatcher* debugMessageDispatcher, int debugPort, EngineFlags flags = EF_None);
 	~V8EngineProxy();
 
-	static Local<String> GetErrorMessage(Local<v8::Context> ctx, TryCatch &tryCatch);
+	// True if the engine is owned by a single thread (see 'EF_ThreadAffine').
+	bool IsThreadAffine() { return _ThreadAffine; }
+	// True if the calling thread may use the engine without a 'v8::Locker' (always true for engines that are not thread-affine).
+	bool IsOwnerThread() { return !_ThreadAffine || std::this_thread::get_id() == _OwnerThread; }
+	// True if the current context is already entered (thread-affine engines, or during a session), in which case 'BEGIN_CONTEXT_SCOPE' does nothing.
+	bool IsContextEntered();
+
+	// Opens a session on the calling thread, which keeps the isolate locked and the scopes entered until 'EndSession()' is called (see
+	// 'EngineSession').  Sessions can be nested.  If another thread has a session open, this waits until that session ends.  Returns the
+	// session depth, or -1 if the engine is thread-affine and the calling thread is not its owner (the owner holds the lock for the life
+	// of the engine, so no other thread can ever get it).
+	int32_t BeginSession();
+	// Closes the session opened by the last 'BeginSession()' call.  Returns the remaining session depth, or -1 if the calling thread has
+	// no session open.
+	int32_t EndSession();
+	// True if the calling thread has a session open.
+	bool InSession() { return _SessionThread.load() == std::this_thread::get_id() && _Session.load() != nullptr; }
+	// True if a different thread has a session open (which holds the isolate lock, so calls from this thread would block until it ends).
+	bool InOtherThreadSession() { return _Session.load() != nullptr && _SessionThread.load() != std::this_thread::get_id(); }
+
+	// Creates an error handle for a caught exception.  The error details are kept in a 'ScriptError' instance and only formatted when requested.
+	HandleProxy* GetErrorHandleProxy(TryCatch &tryCatch, JSValueType errorType);
 
 	// Returns the next object ID for objects that do NOT have a corresponding object.  These objects still need an ID, and are given values less than -1.
 	int32_t GetNextNonTemplateObjectID()
@@ -773,6 +1485,10 @@ public:
 	// Gets an available handle proxy, or creates a new one, for the specified handle.
 	HandleProxy* GetHandleProxy(Handle<Value> handle);
 
+	// Returns the handle proxy with the given ID, or null if there is none or it was disposed.  This is used for handles referenced by
+	// data written on the managed side (see 'CommandInterpreter'), which cannot be trusted to hold valid pointers.
+	HandleProxy* GetHandleProxyByID(int32_t id);
+
 	// Queue a handle for disposal later.  This is typically done when the engine is busy running a script and another call is made
 	// (possibly by the GC finalizer) to dispose a handle.
 	void QueueHandleDisposal(HandleProxy *handleProxy);
@@ -780,6 +1496,12 @@ public:
 	// Registers the handle proxy as disposed for recycling.
 	void DisposeHandleProxy(HandleProxy *handleProxy);
 
+	// Queue a template for deletion later.  This is done when the managed GC finalizes a template while the engine is busy running a
+	// script, or is owned by (or in a session on) another thread.  The templates are deleted the next time the handle queues are
+	// processed outside of a script.
+	void QueueTemplateDeletion(ObjectTemplateProxy *proxy);
+	void QueueTemplateDeletion(FunctionTemplateProxy *proxy);
+
 	// Puts a handle proxy into a queue to be made weak via 'GetHandleProxy()' - which may be required during a long script execution.
 	void QueueMakeWeak(HandleProxy *handleProxy);
 	// Puts a handle proxy into a queue to be made strong via 'GetHandleProxy()' - which may be required during a long script execution.
@@ -821,19 +1543,320 @@ public:
 	HandleProxy* CreateError(const char* message, JSValueType errorType);
 	HandleProxy* CreateError(const uint16_t* message, JSValueType errorType);
 	HandleProxy* CreateDate(double ms);
-	HandleProxy* CreateArray(HandleProxy** items, uint16_t length);
-	HandleProxy* CreateArray(uint16_t** items, uint16_t length);
+	HandleProxy* CreateArray(HandleProxy** items, int32_t length);
+	HandleProxy* CreateArray(uint16_t** items, int32_t length);
+	// Creates an array of strings from a string table ('lengths' can be null if the strings are null terminated; null strings become null values).
+	HandleProxy* CreateArray(const uint16_t* const* strings, const int32_t* lengths, int32_t count);
+	HandleProxy* CreateArray(const double* values, int32_t length);
+	HandleProxy* CreateArray(const int32_t* values, int32_t length);
+
+	// Reads numeric elements from an array or typed array, starting at 'start', into 'buffer'.  Elements that are not numbers are read as NaN (or 0
+	// for integers).  Returns the number of elements read, or -1 if the value is not an array or typed array.
+	int32_t ReadArray(Local<Value> value, int32_t start, double* buffer, int32_t count);
+	int32_t ReadArray(Local<Value> value, int32_t start, int32_t* buffer, int32_t count);
 	HandleProxy* CreateObject(int32_t managedObjectID);
 	HandleProxy* CreateNullValue();
 
+	PooledArrayBufferAllocator* ArrayBufferAllocator() { return _ArrayBufferAllocator; }
+
+	// Creates an array buffer over external memory (no copy is made).  The memory must remain valid until 'releaseCallback' is called.
+	HandleProxy* CreateExternalArrayBuffer(void* data, int64_t length, ManagedReleaseCallback releaseCallback, int32_t releaseID);
+	// Creates a typed array (or data view) over an array buffer.  'length' is the number of elements (bytes for data views).  The view is kept
+	// within the range of 'rangeLength' bytes at 'rangeOffset' in the buffer (the whole buffer if -1), and 'byteOffset' is relative to it.
+	HandleProxy* CreateTypedArray(Local<ArrayBuffer> buffer, TypedArrayType type, int64_t byteOffset, int64_t length, int64_t rangeOffset = 0, int64_t rangeLength = -1);
+
+	// Creates a dataset object over columnar memory owned by the managed side (see 'Dataset').  The memory must remain valid until 'releaseCallback'
+	// is called (it is not called if an error is returned).
+	HandleProxy* CreateDataset(int32_t rowCount, const DatasetColumnInfo* columns, int32_t columnCount, ManagedReleaseCallback releaseCallback, int32_t releaseID);
+
+	// Registers a new object shape and returns its ID.
+	int32_t RegisterShape(const uint16_t** names, const ShapeFieldType* types, int32_t count);
+	// Returns the shape for the given ID, or null if the ID is not valid.
+	ObjectShape* GetShape(int32_t id) { return id >= 0 && (size_t)id < _Shapes.size() ? _Shapes[id] : nullptr; }
+
+	// Registers an (internalized) property name for command buffers and returns its ID (see 'CommandOpCode').
+	int32_t RegisterCommandName(const uint16_t* name);
+	// Returns a property name registered for command buffers, or an empty handle if the ID is not valid.
+	Local<String> GetCommandName(int32_t id);
+
+	ArgumentArena& GetArgumentArena() { return _ArgumentArena; }
+
+	// Invalidates the property values cached for all objects (each cache is cleared the next time it is used).
+	void InvalidatePropertyCaches() { _PropertyCacheVersion++; }
+	int32_t PropertyCacheVersion() { return _PropertyCacheVersion; }
+
+	// Creates the data for an accessor that calls back into the managed side (see 'ObjectTemplateProxy::AccessorGetterCallbackProxy()').
+	Local<External> CreateManagedAccessors(int32_t managedObjectID, ManagedAccessorGetter getter, ManagedAccessorSetter setter);
+
+	// Converts a marshalled primitive value into a V8 value.
+	Local<Value> GetValue(const PrimitiveValue &value);
+	// Converts a V8 value into a marshalled primitive value (a handle proxy is created only if the value is not a primitive).
+	void GetPrimitiveValue(Local<Value> value, PrimitiveValue &result);
+	// Sets a marshalled primitive value to reference a handle proxy.  The type is always one the managed side treats as a handle,
+	// so the proxy gets disposed (errors, symbols, and other values the handle proxy types as undefined are typed as objects).
+	void SetPrimitiveHandle(HandleProxy *handleProxy, PrimitiveValue &result);
+
+	// Returns the cached private key for one of the well known keys.
+	Local<Private> GetPrivateKey(PrivateKeyID id) { return _PrivateKeys[id]; }
+	// Returns the private key for the given name, which is only created the first time it is requested.
+	Local<Private> GetPrivateKey(const char* name);
+
 	Local<Private> CreatePrivateString(const char* data);
 	void SetObjectPrivateValue(Local<Object> obj, const char* name, Local<Value> value);
 	Local<Value> GetObjectPrivateValue(Local<Object> obj, const char* name);
+	void SetObjectPrivateValue(Local<Object> obj, PrivateKeyID id, Local<Value> value);
+	Local<Value> GetObjectPrivateValue(Local<Object> obj, PrivateKeyID id);
 
 	friend HandleProxy;
 	friend ObjectTemplateProxy;
 	friend FunctionTemplateProxy;
 	friend ContextProxy;
+	friend Dataset;
+};
+
+// ========================================================================================================================
+
+// Locks and enters the isolate of an engine for the duration of a call (see 'BEGIN_ISOLATE_SCOPE').  The owner thread of a thread-affine
+// engine already holds the lock, so only the isolate is entered for them (the isolate is not left entered between calls, since V8 requires
+// isolates to be entered and exited in order, and a thread may own more than one engine).  Nothing is done on a thread with a session open.
+class EngineIsolateScope
+{
+	v8::Isolate* _Isolate; // (null if the calling thread has a session open)
+	bool _Locked; // (true if '_Locker' was constructed)
+	alignas(v8::Locker) byte _Locker[sizeof(v8::Locker)];
+
+public:
+	EngineIsolateScope(V8EngineProxy* engine) : _Isolate(engine->InSession() ? nullptr : engine->Isolate()), _Locked(_Isolate != nullptr && !engine->IsThreadAffine())
+	{
+#if DEBUG
+		if (engine->IsThreadAffine() && !engine->IsOwnerThread())
+			throw exception("EngineIsolateScope(): Assertion failed: A thread-affine engine was called from a thread other than the one that created it.");
+#endif
+		if (_Locked)
+			new (_Locker) v8::Locker(_Isolate);
+		if (_Isolate != nullptr)
+			_Isolate->Enter();
+	}
+
+	~EngineIsolateScope()
+	{
+		if (_Isolate != nullptr)
+			_Isolate->Exit();
+		if (_Locked)
+			((v8::Locker*)_Locker)->~Locker();
+	}
+};
+
+// Enters the current context of an engine for the duration of a call (see 'BEGIN_CONTEXT_SCOPE').  Thread-affine engines keep their
+// context entered (see 'V8EngineProxy::SetContext()'), so nothing is done for them.
+class EngineContextScope
+{
+	Local<v8::Context> _Context; // (empty if the context is already entered)
+
+public:
+	EngineContextScope(V8EngineProxy* engine)
+	{
+		if (!engine->IsContextEntered())
+		{
+			_Context = engine->Context();
+			_Context->Enter();
+		}
+	}
+
+	~EngineContextScope()
+	{
+		if (!_Context.IsEmpty())
+			_Context->Exit();
+	}
+};
+
+// Holds the isolate lock, the isolate scope, a handle scope, and the context scope open across many calls into an engine from one thread
+// (see 'V8EngineProxy::BeginSession()').  While a session is open, 'BEGIN_ISOLATE_SCOPE' and 'BEGIN_CONTEXT_SCOPE' only open a nested
+// handle scope on that thread (so values created by each call are still released when the call returns).  Note: The context that was
+// current when the session started stays entered, so the context should not be changed during a session.  Since the isolate also stays
+// entered, sessions on different engines from the same thread must end in the reverse order they were started.
+// (the scopes are constructed in place, since V8 does not allow creating them on the heap)
+class EngineSession
+{
+	v8::Isolate* _Isolate;
+	bool _Locked; // (false for thread-affine engines, since the owner thread already holds the lock)
+	bool _ContextEntered; // (false if the engine has no context yet, or the context is already entered)
+	alignas(v8::Locker) byte _Locker[sizeof(v8::Locker)];
+	alignas(v8::HandleScope) byte _HandleScope[sizeof(v8::HandleScope)];
+	alignas(v8::Context::Scope) byte _ContextScope[sizeof(v8::Context::Scope)];
+
+public:
+	EngineSession(V8EngineProxy* engine);
+	~EngineSession();
+
+	bool ContextEntered() { return _ContextEntered; }
+};
+
+// ========================================================================================================================
+
+// The value tags used by the binary serialization format (see 'ObjectSerializer').  Each value is a one byte tag followed by
+// any data for the value (all numbers are little endian):
+//   ST_Int32: int32; ST_Number and ST_Date: double; ST_String: int32 length + UTF16 characters;
+//   ST_Array: int32 count + values; ST_Object: int32 count + (int32 name length + UTF16 name characters + value) pairs.
+// (when updating, don't forget to update the managed side also!)
+enum SerializedType : byte
+{
+	ST_Undefined, // (also used for values that cannot be serialized, such as functions and symbols)
+	ST_Null,
+	ST_False,
+	ST_True,
+	ST_Int32,
+	ST_Number,
+	ST_String,
+	ST_Date,
+	ST_Array,
+	ST_Object
+};
+
+// Results returned by the serialization exports (the number of bytes is returned on success instead).
+enum SerializerResult : int32_t
+{
+	SR_Success = 0,
+	SR_InvalidValue = -1, // (the handle is empty, or the data to deserialize is not valid)
+	SR_CycleDetected = -2, // (an object references itself, either directly or through one of its children)
+	SR_MaxDepthExceeded = -3,
+	SR_MaxSizeExceeded = -4,
+	SR_ScriptError = -5 // (a property getter threw an exception)
+};
+
+// Writes a value (and any objects it references) into a buffer using a compact tagged binary format.  The buffer can be supplied by the caller;
+// if none is given, or the data outgrows it, a new buffer is allocated using 'ALLOC_MANAGED_MEM()'.
+class ObjectSerializer
+{
+	V8EngineProxy* _EngineProxy;
+	Local<v8::Context> _Context;
+
+	byte* _Buffer;
+	int32_t _Capacity;
+	int32_t _Length;
+	bool _OwnsBuffer; // (true once the buffer was allocated by this instance)
+
+	int32_t _MaxDepth;
+	int32_t _MaxSize;
+
+	vector<Local<Object>> _Path; // (the objects currently being written, to detect cycles)
+
+	SerializerResult _Result;
+
+	bool _Reserve(int32_t size);
+	void _Write(SerializedType tag) { _Buffer[_Length++] = tag; }
+	void _Write(int32_t value) { memcpy(_Buffer + _Length, &value, sizeof(value)); _Length += sizeof(value); }
+	void _Write(double value) { memcpy(_Buffer + _Length, &value, sizeof(value)); _Length += sizeof(value); }
+	bool _WriteString(Local<String> str, bool tagged);
+	bool _WriteObject(Local<Object> obj, int32_t depth);
+	bool _WriteValue(Local<Value> value, int32_t depth);
+
+public:
+
+	ObjectSerializer(V8EngineProxy* engineProxy, byte* buffer, int32_t capacity, int32_t maxDepth, int32_t maxSize);
+
+	// Serializes the value and returns the number of bytes written, or one of the 'SerializerResult' error values.
+	int32_t Serialize(Local<Value> value);
+
+	byte* Buffer() { return _Buffer; }
+	int32_t Capacity() { return _Capacity; }
+};
+
+// Builds a value (and any objects it references) from data written in the 'ObjectSerializer' format.  Property names are internalized, since
+// the same names are usually repeated across many objects.
+class ObjectDeserializer
+{
+	V8EngineProxy* _EngineProxy;
+	Local<v8::Context> _Context;
+
+	const byte* _Data;
+	int32_t _Length;
+	int32_t _Position;
+
+	int32_t _MaxDepth;
+
+	SerializerResult _Result;
+
+	bool _Require(int64_t size);
+	bool _Read(int32_t &value);
+	bool _Read(double &value);
+	bool _ReadString(Local<String> &str, bool internalize);
+	bool _ReadValue(Local<Value> &value, int32_t depth);
+
+public:
+
+	ObjectDeserializer(V8EngineProxy* engineProxy, const byte* data, int32_t length, int32_t maxDepth);
+
+	// Builds the value from the data, and returns 'SR_Success' or one of the 'SerializerResult' error values.
+	SerializerResult Deserialize(Local<Value> &value);
+};
+
+// ========================================================================================================================
+
+// The commands of a command buffer (see 'CommandInterpreter').  Each command is a one byte op code followed by its operands (all numbers are
+// little endian, with no padding).  Values are kept on a stack while the commands run; the stack effect of each command is shown as
+// [before] -> [after], with the top of the stack on the right.  Property names are referenced by the IDs returned from 'RegisterCommandName()'.
+// (when updating, don't forget to update the managed side also!)
+enum CommandOpCode : byte
+{
+	CO_End, // Stops running the commands (optional; the commands also end at the end of the buffer).
+	CO_PushUndefined, // [] -> [undefined]
+	CO_PushNull, // [] -> [null]
+	CO_PushBool, // byte: [] -> [value]
+	CO_PushInt32, // int32: [] -> [value]
+	CO_PushNumber, // double: [] -> [value]
+	CO_PushString, // int32 length + UTF16 characters: [] -> [value]
+	CO_PushHandle, // int32 engine ID + int32 handle ID (-1 for undefined) + int32 handle generation: [] -> [value] (the handle is not disposed)
+	CO_PushGlobal, // [] -> [global object]
+	CO_CreateObject, // [] -> [object]
+	CO_CreateArray, // int32 length: [] -> [array]
+	CO_Dup, // [value] -> [value, value]
+	CO_Pop, // [value] -> []
+	CO_GetProperty, // int32 name ID: [object] -> [value]
+	CO_SetProperty, // int32 name ID: [object, value] -> [object]
+	CO_GetIndex, // int32 index: [object] -> [value]
+	CO_SetIndex, // int32 index: [object, value] -> [object]
+	CO_Call, // int32 argument count: [function, this, arguments...] -> [result]
+	CO_CallMethod, // int32 name ID + int32 argument count: [object, arguments...] -> [result] (calls the named function property with the object as 'this')
+	CO_Read, // [value] -> [] (writes the value into the next result)
+	CO_Count
+};
+
+// Runs a command buffer written by the managed side (see 'CommandOpCode'), so that many operations are done with a single native call.  Values
+// read with 'CO_Read' are written into the results as primitive values (handles are created only for values that are not primitives).
+class CommandInterpreter
+{
+	V8EngineProxy* _EngineProxy;
+	Local<v8::Context> _Context;
+
+	const byte* _Data;
+	int32_t _Length;
+	int32_t _Position;
+
+	PrimitiveValue* _Results;
+	int32_t _ResultCapacity;
+	int32_t _ResultCount;
+
+	vector<Local<Value>> _Stack;
+
+	const char* _Error; // (set if the commands are not valid)
+
+	template <typename T> bool _Read(T &value);
+	bool _Pop(Local<Value> &value);
+	bool _PopObject(Local<Object> &obj);
+	bool _GetName(int32_t id, Local<String> &name);
+	bool _Call(int32_t argCount, Local<Value> function, Local<Value> _this);
+	bool _Run(CommandOpCode op);
+
+public:
+
+	CommandInterpreter(V8EngineProxy* engineProxy, const byte* data, int32_t length, PrimitiveValue* results, int32_t resultCapacity);
+
+	// Runs the commands.  Returns null on success, or an error handle if a script error occurred or the commands are not valid.
+	HandleProxy* Execute();
+
+	// The number of results written (including those written before any error).
+	int32_t ResultCount() { return _ResultCount; }
 };
 
 // ========================================================================================================================
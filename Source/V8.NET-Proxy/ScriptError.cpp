@@ -0,0 +1,229 @@
+#include "ProxyTypes.h"
+
+// ------------------------------------------------------------------------------------------------------------------------
+
+ScriptError::ScriptError(V8EngineProxy* engineProxy, TryCatch &tryCatch)
+	: _EngineProxy(engineProxy), _Terminated(tryCatch.HasTerminated())
+{
+	auto msg = tryCatch.Message();
+	if (!msg.IsEmpty())
+		_Message = CopyablePersistent<Message>(msg);
+
+	auto excep = tryCatch.Exception();
+	if (!excep.IsEmpty())
+		_Exception = CopyablePersistent<Value>(excep);
+}
+
+ScriptError::~ScriptError()
+{
+	if (!_Message.IsEmpty())
+		_Message.Reset();
+	if (!_Exception.IsEmpty())
+		_Exception.Reset();
+	_EngineProxy = nullptr;
+}
+
+// ------------------------------------------------------------------------------------------------------------------------
+
+Local<String> ScriptError::MessageText()
+{
+	return !_Message.IsEmpty() ? _Message->Get() : NewString("");
+}
+
+int32_t ScriptError::LineNumber()
+{
+	return !_Message.IsEmpty() ? _Message->GetLineNumber(_EngineProxy->Context()).FromMaybe(-1) : -1;
+}
+
+int32_t ScriptError::StartColumn()
+{
+	return !_Message.IsEmpty() ? _Message->GetStartColumn(_EngineProxy->Context()).FromMaybe(-1) : -1;
+}
+
+Local<Value> ScriptError::ScriptName()
+{
+	return !_Message.IsEmpty() ? _Message->GetScriptResourceName() : Local<Value>();
+}
+
+Local<Value> ScriptError::SourceLine()
+{
+	Local<String> line;
+	if (!_Message.IsEmpty() && _Message->GetSourceLine(_EngineProxy->Context()).ToLocal(&line))
+		return line;
+	return Local<Value>();
+}
+
+Local<Value> ScriptError::Exception()
+{
+	return _Exception;
+}
+
+// ------------------------------------------------------------------------------------------------------------------------
+
+// Returns true if the string 'str' starts with the string 'prefix'. The strings are compared in small chunks on the stack to
+// avoid making a heap copy of the (usually much larger) stack string.
+static bool _StartsWith(Isolate* isolate, Local<String> str, Local<String> prefix)
+{
+	const int chunkSize = 128;
+	uint16_t a[chunkSize], b[chunkSize];
+
+	auto length = prefix->Length();
+	if (str->Length() < length) return false;
+
+	for (auto pos = 0; pos < length; pos += chunkSize)
+	{
+		auto count = length - pos < chunkSize ? length - pos : chunkSize;
+		str->Write(isolate, a, pos, count, String::NO_NULL_TERMINATION);
+		prefix->Write(isolate, b, pos, count, String::NO_NULL_TERMINATION);
+		if (memcmp(a, b, count * sizeof(uint16_t)) != 0) return false;
+	}
+
+	return true;
+}
+
+// Gets the stack string, and the position within it where the stack details start (past any repeated exception message).
+bool ScriptError::_GetStack(Local<String> &stackStr, int32_t &start)
+{
+	if (_Exception.IsEmpty()) return false;
+
+	auto ctx = _EngineProxy->Context();
+
+	// ... same as 'TryCatch::StackTrace()', but only done when requested ...
+	// (reading 'stack' or converting the exception can run script [getters, or an overridden 'toString()'], so any error here is caught and
+	// discarded; the caller then falls back to the message text)
+
+	TryCatch __tryCatch(_EngineProxy->Isolate());
+
+	Local<Value> excep = _Exception;
+	if (!excep->IsObject()) return false;
+
+	Local<Value> stack;
+	if (!excep.As<Object>()->Get(ctx, NewString("stack")).ToLocal(&stack) || stack->IsUndefined() || !stack->ToString(ctx).ToLocal(&stackStr))
+		return false;
+
+	// ... detect if the start of the stack message is the same as the exception message, then skip it (seems to happen when managed side returns an error) ...
+
+	Local<String> exceptionMsg;
+	start = excep->ToString(ctx).ToLocal(&exceptionMsg) && _StartsWith(_EngineProxy->Isolate(), stackStr, exceptionMsg) ? exceptionMsg->Length() : 0;
+
+	return true;
+}
+
+Local<Value> ScriptError::Stack()
+{
+	Local<String> stackStr;
+	int32_t start;
+
+	if (!_GetStack(stackStr, start)) return Local<Value>();
+	if (start == 0) return stackStr;
+
+	auto length = stackStr->Length() - start;
+	auto stackPart = _StringItem(_EngineProxy, length);
+	stackStr->Write(_EngineProxy->Isolate(), stackPart.String, start, length);
+	auto result = NewSizedUString(stackPart.String, length);
+	stackPart.Free();
+
+	return result;
+}
+
+// ------------------------------------------------------------------------------------------------------------------------
+
+Local<Value> ScriptError::GetField(ScriptErrorField field)
+{
+	switch (field)
+	{
+	case SEF_Message: return MessageText();
+	case SEF_ScriptName: return ScriptName();
+	case SEF_SourceLine: return SourceLine();
+	case SEF_Stack: return Stack();
+	case SEF_Exception: return Exception();
+	default: return Local<Value>();
+	}
+}
+
+// ------------------------------------------------------------------------------------------------------------------------
+
+// Writes the decimal digits of 'value' into 'buffer' (if not null) and returns the number of characters required.
+static int32_t _WriteInt(uint16_t* buffer, int32_t value)
+{
+	uint16_t digits[12];
+	int32_t count = 0;
+	uint32_t v = value < 0 ? (uint32_t)(-(int64_t)value) : (uint32_t)value;
+
+	do { digits[count++] = (uint16_t)('0' + v % 10); v /= 10; } while (v > 0);
+	if (value < 0) digits[count++] = '-';
+
+	if (buffer != nullptr)
+		for (auto i = 0; i < count; i++)
+			buffer[i] = digits[count - 1 - i];
+
+	return count;
+}
+
+// Appends an ASCII string literal (when 'buffer' is null, only the length is added to 'pos').
+static void _Append(uint16_t* buffer, int32_t &pos, const char* str)
+{
+	for (; *str != 0; ++str, ++pos)
+		if (buffer != nullptr) buffer[pos] = (uint16_t)*str;
+}
+
+uint16_t* ScriptError::FormatErrorText()
+{
+	auto isolate = _EngineProxy->Isolate();
+
+	// ... gather the parts first; only the stack requires any real work, and it is only read once ...
+
+	auto msgStr = MessageText();
+	auto messageExists = HasMessage();
+	auto line = messageExists ? LineNumber() : 0;
+	auto col = messageExists ? StartColumn() : 0;
+	Local<String> stackStr;
+	int32_t stackStart = 0;
+	auto stackExists = _GetStack(stackStr, stackStart);
+	auto stackLength = stackExists ? stackStr->Length() - stackStart : 0;
+
+	// ... measure, then write the text in a second pass (into a single allocation) ...
+
+	uint16_t* text = nullptr;
+
+	for (auto pass = 0; pass < 2; pass++)
+	{
+		int32_t pos = 0;
+
+		if (text != nullptr) msgStr->Write(isolate, text, 0, -1, String::NO_NULL_TERMINATION);
+		pos += msgStr->Length();
+
+		if (_Terminated)
+		{
+			if (msgStr->Length() > 0)
+				_Append(text, pos, "\r\n");
+			_Append(text, pos, "Script execution aborted by request.");
+		}
+
+		if (messageExists)
+		{
+			_Append(text, pos, "\r\n  Line: ");
+			pos += _WriteInt(text != nullptr ? text + pos : nullptr, line);
+			_Append(text, pos, "  Column: ");
+			pos += _WriteInt(text != nullptr ? text + pos : nullptr, col);
+		}
+
+		if (stackExists)
+		{
+			_Append(text, pos, "\r\n  Stack: ");
+			if (text != nullptr) stackStr->Write(isolate, text + pos, stackStart, stackLength, String::NO_NULL_TERMINATION);
+			pos += stackLength;
+		}
+
+		_Append(text, pos, "\r\n");
+
+		if (text == nullptr)
+			text = (uint16_t*)ALLOC_MANAGED_MEM(sizeof(uint16_t) * (pos + 1));
+		else
+			text[pos] = 0;
+	}
+
+	return text;
+}
+
+// ------------------------------------------------------------------------------------------------------------------------
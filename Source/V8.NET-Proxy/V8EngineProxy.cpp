@@ -41,6 +41,9 @@ void _StringItem::Clear() { String = nullptr; Length = 0; }
 
 static bool _V8Initialized = false;
 
+// (names for the well known private keys; must be in the same order as 'PrivateKeyID')
+static const char* _PrivateKeyNames[PK_Count] = { "ManagedObjectID", "CLRTypeID", "Dataset" };
+
 vector<bool> V8EngineProxy::_DisposedEngines(100, false);
 
 int32_t V8EngineProxy::_NextEngineID = 0;
@@ -65,17 +68,12 @@ Handle<v8::Context> V8EngineProxy::Context() { return _Context; }
 
 // ------------------------------------------------------------------------------------------------------------------------
 
-//class ArrayBufferAllocator : public v8::ArrayBuffer::Allocator {
-//public:
-//	virtual void* Allocate(size_t length) { return malloc(length); }
-//	virtual void* AllocateUninitialized(size_t length) { return malloc(length); }
-//	virtual void Free(void* data, size_t length) { free(data); }
-//};
-
-V8EngineProxy::V8EngineProxy(bool enableDebugging, DebugMessageDispatcher* debugMessageDispatcher, int debugPort)
-	:ProxyBase(V8EngineProxyClass), /*?_GlobalObjectTemplateProxy(nullptr),*/ _NextNonTemplateObjectID(-2),
-	_IsExecutingScript(false), _InCallbackScope(0), _IsTerminatingScript(false), _Handles(1000, nullptr), _HandlesPendingDisposal(1000, nullptr), _DisposedHandles(1000, -1), _HandlesToBeMadeWeak(1000, nullptr),
-	_HandlesToBeMadeStrong(1000, nullptr), _Objects(1000, nullptr), _Strings(1000, _StringItem())
+V8EngineProxy::V8EngineProxy(bool enableDebugging, DebugMessageDispatcher* debugMessageDispatcher, int debugPort, EngineFlags flags)
+	:ProxyBase(V8EngineProxyClass), /*?_GlobalObjectTemplateProxy(nullptr),*/ _NextNonTemplateObjectID(-2), _Strings(1000, _StringItem()),
+	_Handles(1000, nullptr), _HandlesPendingDisposal(1000, nullptr), _DisposedHandles(1000, -1), _TemplatesPendingDeletion(0), _HandlesToBeMadeWeak(1000, nullptr),
+	_HandlesToBeMadeStrong(1000, nullptr), _Objects(1000, nullptr), _IsExecutingScript(false), _InCallbackScope(0), _IsTerminatingScript(false),
+	_ThreadAffine((flags & EF_ThreadAffine) != 0), _OwnerThread(std::this_thread::get_id()), _OwnerLocker(nullptr), _ContextEntered(false),
+	_Session(nullptr), _SessionThread(std::thread::id()), _SessionDepth(0)
 {
 	if (!_V8Initialized) // (the API changed: https://groups.google.com/forum/#!topic/v8-users/wjMwflJkfso)
 	{
@@ -84,8 +82,7 @@ V8EngineProxy::V8EngineProxy(bool enableDebugging, DebugMessageDispatcher* debug
 		//?v8::V8::InitializeExternalStartupData(PLATFORM_TARGET "\\");
 		// (Startup data is not included by default anymore)
 
-		_Platform = v8::platform::NewDefaultPlatform();
-		v8::V8::InitializePlatform(_Platform.get());
+		v8::V8::InitializePlatform(ProxyPlatform::GetInstance()); // (the platform is process-wide and is never released; see 'ConfigurePlatform()')
 
 		v8::V8::Initialize();
 
@@ -93,9 +90,13 @@ V8EngineProxy::V8EngineProxy(bool enableDebugging, DebugMessageDispatcher* debug
 	}
 
 	Isolate::CreateParams params;
-	params.array_buffer_allocator = v8::ArrayBuffer::Allocator::NewDefaultAllocator();
+	_ArrayBufferAllocator = new PooledArrayBufferAllocator();
+	params.array_buffer_allocator = _ArrayBufferAllocator;
 	_Isolate = Isolate::New(params);
 
+	if (_ThreadAffine)
+		_OwnerLocker = new v8::Locker(_Isolate); // (only the owner thread will use this isolate, so it stays locked until the engine is destroyed)
+
 	BEGIN_ISOLATE_SCOPE(this);
 
 	_Handles.clear();
@@ -107,9 +108,13 @@ V8EngineProxy::V8EngineProxy(bool enableDebugging, DebugMessageDispatcher* debug
 	_Strings.clear();
 
 	_ManagedV8GarbageCollectionRequestCallback = nullptr;
+	_PropertyCacheVersion = 0;
 
 	_Isolate->SetData(0, this); // (sets a reference in the isolate to the proxy [useful within callbacks])
 
+	for (auto i = 0; i < PK_Count; i++)
+		_PrivateKeys[i] = Private::ForApi(_Isolate, NewString(_PrivateKeyNames[i]));
+
 	if ((vector<bool>::size_type)_NextEngineID >= _DisposedEngines.capacity())
 		_DisposedEngines.resize(_DisposedEngines.capacity() + 32);
 
@@ -129,6 +134,12 @@ V8EngineProxy::~V8EngineProxy()
 	{
 		lock_guard<recursive_mutex> handleSection(_HandleSystemMutex);
 
+		if (InSession())
+		{
+			_SessionDepth = 1; // (close all nested sessions)
+			EndSession();
+		}
+
 		BEGIN_ISOLATE_SCOPE(this);
 
 		// ... empty all handles to be sure they won't be accessed ...
@@ -147,21 +158,68 @@ V8EngineProxy::~V8EngineProxy()
 		for (size_t i = 0; i < _DisposedHandles.size(); i++)
 			_Handles[_DisposedHandles[i]]->_Dispose(false); // (engine is flagged as disposed, so this call will only delete the instance)
 
+		_DeletePendingTemplates(); // (the managed side no longer references these)
+
 		// Note: the '_GlobalObjectTemplateProxy' instance is not deleted because the managed GC will do that later (if not before this).
 		//?_GlobalObjectTemplateProxy = nullptr;
 
 		if (!_GlobalObject.IsEmpty())
 			_GlobalObject.Reset();
 
+		if (_ContextEntered)
+		{
+			Context()->Exit();
+			_ContextEntered = false;
+		}
+
 		if (!_Context.IsEmpty())
 			_Context.Reset();
 
+		for (auto i = 0; i < PK_Count; i++)
+			_PrivateKeys[i].Reset();
+		_CustomPrivateKeys.clear();
+
+		// ... release any external memory still referenced by array buffers (the engine is going away, so V8 will no longer use it) ...
+
+		while (!_ExternalArrayBuffers.empty())
+			_ReleaseExternalArrayBuffer(*_ExternalArrayBuffers.begin());
+
+		for (auto accessors : _ManagedAccessors)
+		{
+			accessors->Data.Reset();
+			delete accessors;
+		}
+		_ManagedAccessors.clear();
+
+		while (!_Datasets.empty())
+			_ReleaseDataset(*_Datasets.begin());
+		_DatasetRowsTemplate.Reset();
+		_DatasetRowTemplate.Reset();
+
+		for (size_t i = 0; i < _Shapes.size(); i++)
+			delete _Shapes[i];
+		_Shapes.clear();
+
+		for (size_t i = 0; i < _CommandNames.size(); i++)
+		{
+			_CommandNames[i]->Reset();
+			delete _CommandNames[i];
+		}
+		_CommandNames.clear();
+
 		END_ISOLATE_SCOPE;
 
+		if (_OwnerLocker != nullptr)
+		{
+			delete _OwnerLocker;
+			_OwnerLocker = nullptr;
+		}
+
 		_Isolate->Dispose();
 		_Isolate = nullptr;
 
-		_Platform.release();
+		delete _ArrayBufferAllocator; // (the isolate must be disposed first, since it frees any remaining array buffers)
+		_ArrayBufferAllocator = nullptr;
 
 		// ... free the string cache ...
 
@@ -269,6 +327,13 @@ HandleProxy* V8EngineProxy::GetHandleProxy(Handle<Value> handle)
 	return handleProxy;
 }
 
+HandleProxy* V8EngineProxy::GetHandleProxyByID(int32_t id)
+{
+	if (id < 0 || (size_t)id >= _Handles.size()) return nullptr;
+	auto handleProxy = _Handles[id];
+	return handleProxy != nullptr && !handleProxy->IsDisposed() && !handleProxy->IsDisposing() ? handleProxy : nullptr;
+}
+
 void V8EngineProxy::QueueHandleDisposal(HandleProxy *handleProxy)
 {
 	if (handleProxy != nullptr && !handleProxy->IsDisposed() && !handleProxy->IsDisposing())
@@ -307,6 +372,40 @@ void V8EngineProxy::DisposeHandleProxy(HandleProxy *handleProxy)
 
 // ------------------------------------------------------------------------------------------------------------------------
 
+void V8EngineProxy::QueueTemplateDeletion(ObjectTemplateProxy *proxy)
+{
+	lock_guard<std::mutex> handleSection(_DisposingHandleMutex); // NO V8 HANDLE ACCESS HERE BECAUSE OF THE MANAGED GC
+	_ObjectTemplatesPendingDeletion.push_back(proxy);
+	_TemplatesPendingDeletion++;
+}
+
+void V8EngineProxy::QueueTemplateDeletion(FunctionTemplateProxy *proxy)
+{
+	lock_guard<std::mutex> handleSection(_DisposingHandleMutex); // NO V8 HANDLE ACCESS HERE BECAUSE OF THE MANAGED GC
+	_FunctionTemplatesPendingDeletion.push_back(proxy);
+	_TemplatesPendingDeletion++;
+}
+
+void V8EngineProxy::_DeletePendingTemplates()
+{
+	vector<ObjectTemplateProxy*> objectTemplates;
+	vector<FunctionTemplateProxy*> functionTemplates;
+
+	{
+		lock_guard<std::mutex> handleSection(_DisposingHandleMutex); // NO V8 HANDLE ACCESS HERE BECAUSE OF THE MANAGED GC
+		objectTemplates.swap(_ObjectTemplatesPendingDeletion);
+		functionTemplates.swap(_FunctionTemplatesPendingDeletion);
+		_TemplatesPendingDeletion = 0;
+	}
+
+	for (size_t i = 0; i < functionTemplates.size(); i++)
+		delete functionTemplates[i];
+	for (size_t i = 0; i < objectTemplates.size(); i++)
+		delete objectTemplates[i];
+}
+
+// ------------------------------------------------------------------------------------------------------------------------
+
 void V8EngineProxy::QueueMakeWeak(HandleProxy *handleProxy)
 {
 	lock_guard<recursive_mutex> makeWeakSection(_MakeWeakQueueMutex); // NO V8 HANDLE ACCESS HERE BECAUSE OF THE MANAGED GC
@@ -333,6 +432,9 @@ void V8EngineProxy::ProcessHandleQueues(int loops)
 {
 	bool didSomething = true;
 
+	if (_TemplatesPendingDeletion.load() > 0 && !IsExecutingScript()) // (the lists are filled by the managed GC thread, so they are only read under the lock)
+		_DeletePendingTemplates(); // (templates may still be in use by a running script, so they are only deleted outside of one)
+
 	while (loops-- > 0 && didSomething)
 	{
 		// ... process one of each per call ...
@@ -434,6 +536,12 @@ HandleProxy* V8EngineProxy::SetContext(ContextProxy* contextProxy)
 
 	//?_GlobalObjectTemplateProxy = proxy;
 
+	if (_ContextEntered)
+	{
+		Context()->Exit(); // (thread-affine engines keep the current context entered, so switch it over)
+		_ContextEntered = false;
+	}
+
 	if (!_Context.IsEmpty())
 		_Context.Reset(); // (release the handle first)
 
@@ -441,6 +549,13 @@ HandleProxy* V8EngineProxy::SetContext(ContextProxy* contextProxy)
 		_GlobalObject.Reset(); // (release the handle first)
 
 	_Context = contextProxy->_Context; // (set the new context)
+
+	if (_ThreadAffine)
+	{
+		Context()->Enter();
+		_ContextEntered = true;
+	}
+
 	auto global = _Context->Global()->GetPrototype()->ToObject(_Isolate); // (keep a reference to the global object for faster reference)
 	_GlobalObject = global; // (set the new global object)
 
@@ -455,78 +570,15 @@ ContextProxy* V8EngineProxy::GetContext()
 
 // ------------------------------------------------------------------------------------------------------------------------
 
-Local<String> V8EngineProxy::GetErrorMessage(Local<v8::Context> ctx, TryCatch &tryCatch)
+HandleProxy* V8EngineProxy::GetErrorHandleProxy(TryCatch &tryCatch, JSValueType errorType)
 {
-	auto isolate = ctx->GetIsolate();
-	auto msg = tryCatch.Message();
-	auto messageExists = !msg.IsEmpty();
-	auto excep = tryCatch.Exception();
-	auto exceptionExists = !excep.IsEmpty();
-	Local<Value> stack;
-	bool stackExists = tryCatch.StackTrace(ctx).ToLocal(&stack) && !stack->IsUndefined();
-
-	Local<String> stackStr;
-
-	if (stackExists && exceptionExists)
-	{
-		stackStr = stack->ToString(isolate);
-
-		auto exceptionMsg = tryCatch.Exception()->ToString(isolate);
-
-		// ... detect if the start of the stack message is the same as the exception message, then remove it (seems to happen when managed side returns an error) ...
-
-		if (stackStr->Length() >= exceptionMsg->Length())
-		{
-			uint16_t* ss = new uint16_t[stackStr->Length() + 1];
-			stack->ToString(isolate)->Write(isolate, ss); // (copied to a new array in order to offset the character pointer to extract a substring)
-
-			// ... get the same number of characters from the stack message as the exception message length ...
-			auto subStackStr = NewSizedUString(ss, exceptionMsg->Length());
-
-			if (exceptionMsg->Equals(ctx, subStackStr).ToChecked())
-			{
-				// ... using the known exception message length, ...
-				auto stackPartStr = NewSizedUString(ss + exceptionMsg->Length(), stackStr->Length() - exceptionMsg->Length());
-				stackStr = stackPartStr;
-			}
-
-			delete[] ss;
-		}
-	}
-
-	auto msgStr = messageExists ? msg->Get() : NewString("");
-
-	if (tryCatch.HasTerminated())
-	{
-		if (msgStr->Length() > 0)
-			msgStr = msgStr->Concat(isolate, msgStr, NewString("\r\n"));
-		msgStr = msgStr->Concat(isolate, msgStr, NewString("Script execution aborted by request."));
-	}
-
-	if (messageExists)
-	{
-		msgStr = msgStr->Concat(isolate, msgStr, NewString("\r\n"));
-
-		msgStr = msgStr->Concat(isolate, msgStr, NewString("  Line: "));
-		auto line = NewInteger(msg->GetLineNumber(ctx).ToChecked())->ToString(ctx).ToLocalChecked();
-		msgStr = msgStr->Concat(isolate, msgStr, line);
+	// ... the handle references only the message text; the full error text (with location and stack) is formatted later if requested ...
 
-		msgStr = msgStr->Concat(isolate, msgStr, NewString("  Column: "));
-		auto col = NewInteger(msg->GetStartColumn(ctx).ToChecked())->ToString(ctx).ToLocalChecked();
-		msgStr = msgStr->Concat(isolate, msgStr, col);
-	}
-
-	if (stackExists)
-	{
-		msgStr = msgStr->Concat(isolate, msgStr, NewString("\r\n"));
-
-		msgStr = msgStr->Concat(isolate, msgStr, NewString("  Stack: "));
-		msgStr = msgStr->Concat(isolate, msgStr, stackStr);
-	}
-
-	msgStr = msgStr->Concat(isolate, msgStr, NewString("\r\n"));
-
-	return msgStr;
+	auto msg = tryCatch.Message();
+	auto returnVal = GetHandleProxy(!msg.IsEmpty() ? msg->Get() : NewString(""));
+	returnVal->_Error = new ScriptError(this, tryCatch);
+	returnVal->_Type = errorType;
+	return returnVal;
 }
 
 HandleProxy* V8EngineProxy::Execute(const uint16_t* script, uint16_t* sourceName)
@@ -546,8 +598,7 @@ HandleProxy* V8EngineProxy::Execute(const uint16_t* script, uint16_t* sourceName
 
 		if (__tryCatch.HasCaught())
 		{
-			returnVal = GetHandleProxy(GetErrorMessage(_Context, __tryCatch));
-			returnVal->_Type = JSV_CompilerError;
+			returnVal = GetErrorHandleProxy(__tryCatch, JSV_CompilerError);
 		}
 		else if (!compiledScript.IsEmpty())
 			returnVal = Execute(compiledScript.ToLocalChecked());
@@ -576,8 +627,7 @@ HandleProxy* V8EngineProxy::Execute(Handle<Script> script)
 
 		if (__tryCatch.HasCaught())
 		{
-			returnVal = GetHandleProxy(GetErrorMessage(_Context, __tryCatch));
-			returnVal->_Type = __tryCatch.HasTerminated() ? JSV_ExecutionTerminated : JSV_ExecutionError;
+			returnVal = GetErrorHandleProxy(__tryCatch, __tryCatch.HasTerminated() ? JSV_ExecutionTerminated : JSV_ExecutionError);
 		}
 		else  if (!result.IsEmpty())
 			returnVal = GetHandleProxy(result.ToLocalChecked());
@@ -612,8 +662,7 @@ HandleProxy* V8EngineProxy::Compile(const uint16_t* script, uint16_t* sourceName
 
 		if (__tryCatch.HasCaught())
 		{
-			returnVal = GetHandleProxy(GetErrorMessage(_Context, __tryCatch));
-			returnVal->_Type = JSV_CompilerError;
+			returnVal = GetErrorHandleProxy(__tryCatch, JSV_CompilerError);
 		}
 		else if (!compiledScript.IsEmpty())
 		{
@@ -677,11 +726,10 @@ HandleProxy* V8EngineProxy::Call(HandleProxy *subject, const uint16_t *functionN
 
 	if (argCount > 0)
 	{
-		Handle<Value>* _args = new Handle<Value>[argCount];
+		ArgumentBuffer<Local<Value>> _args(_ArgumentArena, argCount);
 		for (auto i = 0; i < argCount; i++)
 			_args[i] = args[i]->Handle();
-		result = hFunc->Call(_Context, hThis.As<Object>(), argCount, _args);
-		delete[] _args;
+		result = hFunc->Call(_Context, hThis.As<Object>(), argCount, _args.Items());
 	}
 	else result = hFunc->Call(_Context, hThis.As<Object>(), 0, nullptr);
 
@@ -689,8 +737,7 @@ HandleProxy* V8EngineProxy::Call(HandleProxy *subject, const uint16_t *functionN
 
 	if (__tryCatch.HasCaught())
 	{
-		returnVal = GetHandleProxy(GetErrorMessage(_Context, __tryCatch));
-		returnVal->_Type = JSV_ExecutionError;
+		returnVal = GetErrorHandleProxy(__tryCatch, JSV_ExecutionError);
 	}
 	else returnVal = result.IsEmpty() ? nullptr : GetHandleProxy(result.ToLocalChecked());
 
@@ -719,19 +766,43 @@ HandleProxy* V8EngineProxy::CreateString(const uint16_t* str)
 	return GetHandleProxy(NewUString(str));
 }
 
+Local<Private> V8EngineProxy::GetPrivateKey(const char* name)
+{
+	for (auto i = 0; i < PK_Count; i++)
+		if (strcmp(name, _PrivateKeyNames[i]) == 0)
+			return _PrivateKeys[i];
+
+	auto &key = _CustomPrivateKeys[name];
+	if (key.IsEmpty())
+		key = Private::ForApi(_Isolate, NewString(name)); // ('ForApi' is required, otherwise a new "virtual" symbol reference of some sort will be created with the same name on each request [duplicate names, but different symbols virtually])
+	return key;
+}
+
 Local<Private> V8EngineProxy::CreatePrivateString(const char* value)
 {
-	return Private::ForApi(_Isolate, NewString(value)); // ('ForApi' is required, otherwise a new "virtual" symbol reference of some sort will be created with the same name on each request [duplicate names, but different symbols virtually])
+	return GetPrivateKey(value);
 }
 
 void V8EngineProxy::SetObjectPrivateValue(Local<Object> obj, const char* name, Local<Value> value)
 {
-	obj->SetPrivate(_Context, CreatePrivateString("ManagedObjectID"), value);
+	obj->SetPrivate(_Context, GetPrivateKey(name), value);
 }
 
 Local<Value> V8EngineProxy::GetObjectPrivateValue(Local<Object> obj, const char* name)
 {
-	auto phandle = obj->GetPrivate(_Context, CreatePrivateString("ManagedObjectID"));
+	auto phandle = obj->GetPrivate(_Context, GetPrivateKey(name));
+	if (phandle.IsEmpty()) return V8Undefined;
+	return phandle.ToLocalChecked();
+}
+
+void V8EngineProxy::SetObjectPrivateValue(Local<Object> obj, PrivateKeyID id, Local<Value> value)
+{
+	obj->SetPrivate(_Context, _PrivateKeys[id], value);
+}
+
+Local<Value> V8EngineProxy::GetObjectPrivateValue(Local<Object> obj, PrivateKeyID id)
+{
+	auto phandle = obj->GetPrivate(_Context, _PrivateKeys[id]);
 	if (phandle.IsEmpty()) return V8Undefined;
 	return phandle.ToLocalChecked();
 }
@@ -767,26 +838,113 @@ HandleProxy* V8EngineProxy::CreateObject(int32_t managedObjectID)
 	return handle;
 }
 
-HandleProxy* V8EngineProxy::CreateArray(HandleProxy** items, uint16_t length)
+// (arrays created from a list of elements in one step get the best element kind for the values, such as packed doubles, without any per element stores)
+#define CREATE_ARRAY_FROM_ELEMENTS(length, getElement) \
+{ \
+	if (length <= 0) return GetHandleProxy(NewArray(0)); \
+	vector<Local<Value>> elements(length); \
+	for (int32_t i = 0; i < length; i++) \
+		elements[i] = getElement; \
+	return GetHandleProxy(Array::New(_Isolate, elements.data(), (size_t)length)); \
+}
+
+HandleProxy* V8EngineProxy::CreateArray(HandleProxy** items, int32_t length)
+{
+	if (items == nullptr) return GetHandleProxy(NewArray(length > 0 ? length : 0));
+	CREATE_ARRAY_FROM_ELEMENTS(length, items[i] != nullptr ? items[i]->Handle() : (Local<Value>)V8Undefined);
+}
+
+HandleProxy* V8EngineProxy::CreateArray(uint16_t** items, int32_t length)
+{
+	if (items == nullptr) return GetHandleProxy(NewArray(length > 0 ? length : 0));
+	CREATE_ARRAY_FROM_ELEMENTS(length, items[i] != nullptr ? (Local<Value>)NewUString(items[i]) : (Local<Value>)V8Null);
+}
+
+HandleProxy* V8EngineProxy::CreateArray(const uint16_t* const* strings, const int32_t* lengths, int32_t count)
 {
-	Local<Array> array = NewArray(length);
+	if (strings == nullptr) return GetHandleProxy(NewArray(count > 0 ? count : 0));
+	CREATE_ARRAY_FROM_ELEMENTS(count, strings[i] != nullptr ? (Local<Value>)NewSizedUString(strings[i], lengths != nullptr ? lengths[i] : -1) : (Local<Value>)V8Null);
+}
+
+HandleProxy* V8EngineProxy::CreateArray(const double* values, int32_t length)
+{
+	if (values == nullptr) return GetHandleProxy(NewArray(length > 0 ? length : 0));
+	CREATE_ARRAY_FROM_ELEMENTS(length, NewNumber(values[i]));
+}
+
+HandleProxy* V8EngineProxy::CreateArray(const int32_t* values, int32_t length)
+{
+	if (values == nullptr) return GetHandleProxy(NewArray(length > 0 ? length : 0));
+	CREATE_ARRAY_FROM_ELEMENTS(length, NewInteger(values[i]));
+}
+
+#undef CREATE_ARRAY_FROM_ELEMENTS
+
+// ------------------------------------------------------------------------------------------------------------------------
 
-	if (items != nullptr && length > 0)
-		for (auto i = 0; i < length; i++)
-			array->Set(i, items[i]->_Handle);
+static void _ReadElement(Local<v8::Context> ctx, Local<Value> element, double &result)
+{
+	result = element->IsNumber() ? element.As<Number>()->Value() : std::numeric_limits<double>::quiet_NaN();
+}
 
-	return GetHandleProxy(array);
+static void _ReadElement(Local<v8::Context> ctx, Local<Value> element, int32_t &result)
+{
+	result = element->IsInt32() ? element.As<Int32>()->Value() : element->IsNumber() ? element->Int32Value(ctx).FromMaybe(0) : 0; // (numbers are converted the same as 'x|0')
 }
 
-HandleProxy* V8EngineProxy::CreateArray(uint16_t** items, uint16_t length)
+// Reads numeric elements from an array or typed array.  If the value is a typed array of the same element type (checked by 'isSameType'), the
+// elements are copied directly from the backing store.
+// Note: The element kinds of normal arrays (such as packed doubles or small integers) are not exposed by the V8 API, so those are read by index.
+template <class T>
+static int32_t _ReadArray(V8EngineProxy* engine, Local<Value> value, int32_t start, T* buffer, int32_t count, bool(*isSameType)(Local<Value>))
 {
-	Local<Array> array = NewArray(length);
+	if (value.IsEmpty() || start < 0 || count < 0 || buffer == nullptr && count > 0) return -1;
+
+	int64_t length;
 
-	if (items != nullptr && length > 0)
-		for (auto i = 0; i < length; i++)
-			array->Set(i, NewUString(items[i]));
+	if (value->IsArray())
+		length = value.As<Array>()->Length();
+	else if (value->IsTypedArray())
+	{
+		auto typedArray = value.As<TypedArray>();
+		length = (int64_t)typedArray->Length();
+
+		if (isSameType(value))
+		{
+			if (start >= length) return 0;
+			if (count > length - start) count = (int32_t)(length - start);
+			auto contents = typedArray->Buffer()->GetContents();
+			memcpy(buffer, (byte*)contents.Data() + typedArray->ByteOffset() + (size_t)start * sizeof(T), (size_t)count * sizeof(T));
+			return count;
+		}
+	}
+	else return -1;
 
-	return GetHandleProxy(array);
+	if (start >= length) return 0;
+	if (count > length - start) count = (int32_t)(length - start);
+
+	auto ctx = engine->Context();
+	auto obj = value.As<Object>();
+
+	for (int32_t i = 0; i < count; i++)
+	{
+		Local<Value> element;
+		if (!obj->Get(ctx, (uint32_t)(start + i)).ToLocal(&element))
+			return i;
+		_ReadElement(ctx, element, buffer[i]);
+	}
+
+	return count;
+}
+
+int32_t V8EngineProxy::ReadArray(Local<Value> value, int32_t start, double* buffer, int32_t count)
+{
+	return _ReadArray<double>(this, value, start, buffer, count, [](Local<Value> v) { return v->IsFloat64Array(); });
+}
+
+int32_t V8EngineProxy::ReadArray(Local<Value> value, int32_t start, int32_t* buffer, int32_t count)
+{
+	return _ReadArray<int32_t>(this, value, start, buffer, count, [](Local<Value> v) { return v->IsInt32Array(); });
 }
 
 HandleProxy* V8EngineProxy::CreateNullValue()
@@ -795,3 +953,397 @@ HandleProxy* V8EngineProxy::CreateNullValue()
 }
 
 // ------------------------------------------------------------------------------------------------------------------------
+
+Local<External> V8EngineProxy::CreateManagedAccessors(int32_t managedObjectID, ManagedAccessorGetter getter, ManagedAccessorSetter setter)
+{
+	auto accessors = new ManagedAccessors();
+	accessors->ManagedObjectID = managedObjectID;
+	accessors->Getter = getter;
+	accessors->Setter = setter;
+
+	auto data = NewExternal(accessors);
+	accessors->Data = data;
+	accessors->Data.Value.SetWeak<ManagedAccessors>(accessors, _ManagedAccessorsWeakCallback, WeakCallbackType::kParameter);
+	_ManagedAccessors.insert(accessors);
+
+	return data;
+}
+
+void V8EngineProxy::_ManagedAccessorsWeakCallback(const WeakCallbackInfo<ManagedAccessors>& data)
+{
+	auto engineProxy = (V8EngineProxy*)data.GetIsolate()->GetData(0);
+	auto accessors = data.GetParameter();
+	engineProxy->_ManagedAccessors.erase(accessors);
+	accessors->Data.Reset();
+	delete accessors;
+}
+
+// ------------------------------------------------------------------------------------------------------------------------
+
+HandleProxy* V8EngineProxy::CreateDataset(int32_t rowCount, const DatasetColumnInfo* columns, int32_t columnCount, ManagedReleaseCallback releaseCallback, int32_t releaseID)
+{
+	if (rowCount < 0 || columnCount < 0 || columns == nullptr && columnCount > 0)
+		return CreateError("CreateDataset(): Invalid row or column count.", JSV_InternalError);
+
+	for (auto i = 0; i < columnCount; i++)
+	{
+		auto &column = columns[i];
+		if (column.Name == nullptr)
+			return CreateError("CreateDataset(): A column has no name.", JSV_InternalError);
+		if (column.Type < DC_Number || column.Type > DC_String)
+			return CreateError("CreateDataset(): Invalid column type.", JSV_InternalError);
+		if (column.Data == nullptr && rowCount > 0)
+			return CreateError("CreateDataset(): A column has no data.", JSV_InternalError);
+		if ((uint64_t)rowCount * (column.Type == DC_Number ? sizeof(double) : sizeof(int32_t)) > (uint64_t)SIZE_MAX)
+			return CreateError("CreateDataset(): The column data is too large.", JSV_InternalError);
+		if (column.Type == DC_String && (column.DictionarySize < 0 || column.Dictionary == nullptr && column.DictionarySize > 0))
+			return CreateError("CreateDataset(): Invalid string dictionary.", JSV_InternalError);
+	}
+
+	if (_DatasetRowsTemplate.IsEmpty())
+	{
+		_DatasetRowsTemplate = Dataset::CreateRowsTemplate();
+		_DatasetRowTemplate = Dataset::CreateRowTemplate();
+	}
+
+	auto dataset = new Dataset(this, rowCount, columns, columnCount, releaseCallback, releaseID);
+	_Datasets.insert(dataset);
+
+	TryCatch __tryCatch(_Isolate);
+
+	Local<Object> obj;
+	if (!dataset->CreateObject().ToLocal(&obj))
+	{
+		_ReleaseDataset(dataset); // (nothing else references the column memory yet, so the managed side can release it now)
+		if (__tryCatch.HasCaught())
+			return GetErrorHandleProxy(__tryCatch, JSV_ExecutionError);
+		return CreateError("CreateDataset(): The dataset object could not be created.", JSV_InternalError);
+	}
+
+	return GetHandleProxy(obj);
+}
+
+void V8EngineProxy::_ReleaseDataset(Dataset* dataset)
+{
+	_Datasets.erase(dataset);
+	delete dataset;
+}
+
+// ------------------------------------------------------------------------------------------------------------------------
+
+int32_t V8EngineProxy::RegisterShape(const uint16_t** names, const ShapeFieldType* types, int32_t count)
+{
+	auto id = (int32_t)_Shapes.size();
+	_Shapes.push_back(new ObjectShape(this, id, names, types, count));
+	return id;
+}
+
+// ------------------------------------------------------------------------------------------------------------------------
+
+int32_t V8EngineProxy::RegisterCommandName(const uint16_t* name)
+{
+	Local<String> str = NewInternalizedUString(name);
+	_CommandNames.push_back(new CopyablePersistent<String>(str));
+	return (int32_t)_CommandNames.size() - 1;
+}
+
+Local<String> V8EngineProxy::GetCommandName(int32_t id)
+{
+	if (id < 0 || (size_t)id >= _CommandNames.size()) return Local<String>();
+	return *_CommandNames[id];
+}
+
+// ------------------------------------------------------------------------------------------------------------------------
+
+HandleProxy* V8EngineProxy::CreateExternalArrayBuffer(void* data, int64_t length, ManagedReleaseCallback releaseCallback, int32_t releaseID)
+{
+	if (length < 0 || (uint64_t)length > (uint64_t)SIZE_MAX || data == nullptr && length > 0)
+		return CreateError("CreateExternalArrayBuffer(): Invalid buffer or length.", JSV_InternalError);
+
+	// ... the buffer is 'externalized', so V8 will never free the memory; a weak handle is used to find out when V8 no longer needs it ...
+
+	auto buffer = ArrayBuffer::New(_Isolate, data, (size_t)length, ArrayBufferCreationMode::kExternalized);
+
+	if (releaseCallback != nullptr)
+	{
+		auto external = new ExternalArrayBuffer();
+		external->Buffer = buffer;
+		external->Data = data;
+		external->Length = length;
+		external->ReleaseCallback = releaseCallback;
+		external->ReleaseID = releaseID;
+		external->Buffer.Value.SetWeak<ExternalArrayBuffer>(external, _ExternalArrayBufferWeakCallback, WeakCallbackType::kParameter);
+		_ExternalArrayBuffers.insert(external);
+	}
+
+	return GetHandleProxy(buffer);
+}
+
+void V8EngineProxy::_ExternalArrayBufferWeakCallback(const WeakCallbackInfo<ExternalArrayBuffer>& data)
+{
+	// ... only the handle may be reset in the first pass; calling back into the managed side has to wait for the second pass ...
+
+	data.GetParameter()->Buffer.Reset();
+	data.SetSecondPassCallback(_ExternalArrayBufferReleaseCallback);
+}
+
+void V8EngineProxy::_ExternalArrayBufferReleaseCallback(const WeakCallbackInfo<ExternalArrayBuffer>& data)
+{
+	auto engineProxy = (V8EngineProxy*)data.GetIsolate()->GetData(0);
+	if (engineProxy->_ExternalArrayBuffers.count(data.GetParameter()) > 0) // (the engine may have released it in the meantime)
+		engineProxy->_ReleaseExternalArrayBuffer(data.GetParameter());
+}
+
+void V8EngineProxy::_ReleaseExternalArrayBuffer(ExternalArrayBuffer* buffer)
+{
+	_ExternalArrayBuffers.erase(buffer);
+	buffer->Buffer.Reset();
+
+	_InCallbackScope++;
+	buffer->ReleaseCallback(buffer->Data, buffer->Length, buffer->ReleaseID);
+	_InCallbackScope--;
+
+	delete buffer;
+}
+
+HandleProxy* V8EngineProxy::CreateTypedArray(Local<ArrayBuffer> buffer, TypedArrayType type, int64_t byteOffset, int64_t length, int64_t rangeOffset, int64_t rangeLength)
+{
+	static const int32_t elementSizes[] = { 1, 1, 1, 2, 2, 4, 4, 4, 8, 1 };
+
+	if (type < TA_Int8 || type > TA_DataView)
+		return CreateError("CreateTypedArray(): Invalid typed array type.", JSV_InternalError);
+
+	auto elementSize = elementSizes[type];
+	auto bufferLength = (int64_t)buffer->ByteLength();
+
+	if (rangeLength < 0)
+		rangeLength = bufferLength - rangeOffset;
+	if (rangeOffset < 0 || rangeOffset > bufferLength || rangeLength > bufferLength - rangeOffset)
+		return CreateError("CreateTypedArray(): The existing view is out of range of its buffer.", JSV_InternalError);
+
+	if (byteOffset < 0 || byteOffset > rangeLength || (rangeOffset + byteOffset) % elementSize != 0)
+		return CreateError("CreateTypedArray(): The byte offset is out of range or not aligned to the element size.", JSV_InternalError);
+
+	if (length < 0)
+		length = (rangeLength - byteOffset) / elementSize; // (use the rest of the range)
+	else if (length > (rangeLength - byteOffset) / elementSize)
+		return CreateError("CreateTypedArray(): The length is out of range.", JSV_InternalError);
+
+	auto offset = (size_t)(rangeOffset + byteOffset);
+	auto count = (size_t)length;
+	Local<Value> view;
+
+	switch (type)
+	{
+	case TA_Int8: view = Int8Array::New(buffer, offset, count); break;
+	case TA_Uint8: view = Uint8Array::New(buffer, offset, count); break;
+	case TA_Uint8Clamped: view = Uint8ClampedArray::New(buffer, offset, count); break;
+	case TA_Int16: view = Int16Array::New(buffer, offset, count); break;
+	case TA_Uint16: view = Uint16Array::New(buffer, offset, count); break;
+	case TA_Int32: view = Int32Array::New(buffer, offset, count); break;
+	case TA_Uint32: view = Uint32Array::New(buffer, offset, count); break;
+	case TA_Float32: view = Float32Array::New(buffer, offset, count); break;
+	case TA_Float64: view = Float64Array::New(buffer, offset, count); break;
+	case TA_DataView: view = DataView::New(buffer, offset, count); break;
+	}
+
+	return GetHandleProxy(view);
+}
+
+// ------------------------------------------------------------------------------------------------------------------------
+
+Local<Value> V8EngineProxy::GetValue(const PrimitiveValue &value)
+{
+	switch (value.Type)
+	{
+	case JSV_Null: return V8Null;
+	case JSV_Bool: return NewBool(value.V8Boolean);
+	case JSV_Int32: return NewInteger((int32_t)value.V8Integer);
+	case JSV_Number: return NewNumber(value.V8Number);
+	case JSV_String: return value.V8String != nullptr ? (Local<Value>)NewUString(value.V8String) : (Local<Value>)V8Null;
+	case JSV_Date: return NewDate(_Context, value.V8Number);
+	case JSV_Uninitialized:
+	case JSV_Undefined: return V8Undefined;
+	default: // (any other type is expected to be passed as a handle)
+	{
+		if (value.Handle == nullptr) return V8Undefined;
+		Local<Value> h = value.Handle->Handle();
+		value.Handle->TryDispose(); // (as with other handles passed in from the managed side)
+		return h;
+	}
+	}
+}
+
+void V8EngineProxy::GetPrimitiveValue(Local<Value> value, PrimitiveValue &result)
+{
+	result._Pointer = 0;
+	result.V8Integer = 0;
+
+	if (value.IsEmpty() || value->IsUndefined())
+		result.Type = JSV_Undefined;
+	else if (value->IsNull())
+		result.Type = JSV_Null;
+	else if (value->IsBoolean())
+	{
+		result.Type = JSV_Bool;
+		result.V8Boolean = value->IsTrue();
+	}
+	else if (value->IsInt32())
+	{
+		result.Type = JSV_Int32;
+		result.V8Integer = value.As<Int32>()->Value();
+	}
+	else if (value->IsNumber())
+	{
+		result.Type = JSV_Number;
+		result.V8Number = value.As<Number>()->Value();
+	}
+	else if (value->IsString())
+	{
+		result.Type = JSV_String;
+		result.V8String = _StringItem(this, *value.As<String>()).String; // (note: the string is owned by the managed side until 'FreePrimitiveValues()' is called)
+	}
+	else if (value->IsDate())
+	{
+		result.Type = JSV_Date;
+		result.V8Number = value.As<Date>()->ValueOf();
+	}
+	else
+		SetPrimitiveHandle(GetHandleProxy(value), result);
+}
+
+void V8EngineProxy::SetPrimitiveHandle(HandleProxy *handleProxy, PrimitiveValue &result)
+{
+	result._Pointer = 0;
+	result.V8Integer = 0;
+	result.Handle = handleProxy;
+	result.Type = handleProxy->_Type != JSV_Undefined ? handleProxy->_Type : JSV_Object; // (the managed side ignores undefined values, so the handle would never be disposed)
+}
+
+// ------------------------------------------------------------------------------------------------------------------------
+
+bool V8EngineProxy::IsContextEntered()
+{
+	return _ContextEntered || (InSession() && _Session.load()->ContextEntered()); // (only the session thread can end its session, so it cannot go away here)
+}
+
+int32_t V8EngineProxy::BeginSession()
+{
+	if (!IsOwnerThread())
+		return -1; // (a thread-affine engine is locked by its owner thread, so 'EngineSession' would enter the isolate without the lock)
+
+	if (InSession())
+		return ++_SessionDepth;
+
+	auto session = new EngineSession(this); // (if another thread has a session open, this waits for the lock)
+
+	// ... the thread is set first (and cleared last), so 'InSession()' on this thread never sees another thread's session ...
+
+	_SessionThread = std::this_thread::get_id();
+	_Session = session;
+	_SessionDepth = 1;
+
+	return _SessionDepth;
+}
+
+int32_t V8EngineProxy::EndSession()
+{
+	if (!InSession())
+		return -1;
+
+	if (--_SessionDepth > 0)
+		return _SessionDepth;
+
+	auto session = _Session.load();
+	_Session = nullptr;
+	_SessionThread = std::thread::id();
+
+	delete session; // (releases the lock last)
+
+	return 0;
+}
+
+// ------------------------------------------------------------------------------------------------------------------------
+
+EngineSession::EngineSession(V8EngineProxy* engine)
+	: _Isolate(engine->Isolate()), _Locked(!engine->IsThreadAffine()), _ContextEntered(false)
+{
+	if (_Locked)
+		new (_Locker) v8::Locker(_Isolate);
+
+	_Isolate->Enter();
+
+	::new (_HandleScope) v8::HandleScope(_Isolate);
+
+	if (!engine->IsContextEntered() && !engine->Context().IsEmpty())
+	{
+		::new (_ContextScope) v8::Context::Scope(engine->Context());
+		_ContextEntered = true;
+	}
+}
+
+EngineSession::~EngineSession()
+{
+	if (_ContextEntered)
+		((v8::Context::Scope*)_ContextScope)->~Scope();
+
+	((v8::HandleScope*)_HandleScope)->~HandleScope();
+
+	_Isolate->Exit();
+
+	if (_Locked)
+		((v8::Locker*)_Locker)->~Locker();
+}
+
+// ------------------------------------------------------------------------------------------------------------------------
+
+ArgumentArena::~ArgumentArena()
+{
+	for (auto &block : _Blocks)
+		FREE_MANAGED_MEM(block.Data);
+	_Blocks.clear();
+}
+
+void* ArgumentArena::Allocate(size_t size, Mark &mark)
+{
+	mark.Block = _Block;
+	mark.Offset = _Offset;
+
+	size = (size + 7) & ~(size_t)7; // (keep allocations 8 byte aligned)
+
+	// ... use the current block if there's room, otherwise move on to the next one (any blocks past the current one are unused) ...
+
+	if (_Block < _Blocks.size() && _Offset + size <= _Blocks[_Block].Size)
+	{
+		auto p = _Blocks[_Block].Data + _Offset;
+		_Offset += size;
+		return p;
+	}
+
+	auto next = _Blocks.empty() ? 0 : _Block + 1;
+
+	if (next < _Blocks.size() && _Blocks[next].Size < size)
+	{
+		FREE_MANAGED_MEM(_Blocks[next].Data); // (too small; replaced below)
+		_Blocks.erase(_Blocks.begin() + next);
+	}
+
+	if (next >= _Blocks.size() || _Blocks[next].Size < size)
+	{
+		size_t blockSize = 4096;
+		while (blockSize < size)
+			blockSize *= 2;
+
+		Block block = { (byte*)ALLOC_MANAGED_MEM(blockSize), blockSize };
+		if (block.Data == nullptr)
+			throw exception("ArgumentArena::Allocate(): Out of memory.");
+		_Blocks.insert(_Blocks.begin() + next, block);
+		Stats.HeapAllocations++;
+	}
+
+	_Block = next;
+	_Offset = size;
+	return _Blocks[next].Data;
+}
+
+// ------------------------------------------------------------------------------------------------------------------------
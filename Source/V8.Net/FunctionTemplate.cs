@@ -22,6 +22,12 @@ namespace V8.Net
     /// <param name="args">The arguments supplied for the JavaScript function call.</param>
     public delegate InternalHandle JSFunction(V8Engine engine, bool isConstructCall, InternalHandle _this, params InternalHandle[] args);
 
+    /// <summary>
+    /// A JavaScript callback function that receives a view over the call arguments (see 'FunctionTemplate.SetArgumentsCallback()').
+    /// Handles are only created for the arguments that are requested.
+    /// </summary>
+    public delegate InternalHandle JSArgumentsFunction(V8Engine engine, bool isConstructCall, FunctionArguments args);
+
     // ========================================================================================================================
 
     public unsafe class FunctionTemplate : TemplateBase<IV8Function>, IV8Disposable
@@ -49,6 +55,16 @@ namespace V8.Net
         /// </summary>
         public ObjectTemplate PrototypeTemplate { get; private set; }
 
+        /// <summary>
+        /// The maximum number of arguments passed to a 'PrimitiveNumberArrayFunction' callback (calls with more arguments use the regular callbacks).
+        /// </summary>
+        public const int MaxPrimitiveArguments = 16;
+
+        Delegate _PrimitiveCallback; // (keeps the delegate given to the native side alive)
+
+        JSArgumentsFunction _ArgumentsCallback;
+        NativeFunctionArgsCallback _NativeArgumentsCallback; // (created once, when first needed)
+
         // --------------------------------------------------------------------------------------------------------------------
 
         public FunctionTemplate()
@@ -373,6 +389,92 @@ namespace V8.Net
 
         // --------------------------------------------------------------------------------------------------------------------
 
+        /// <summary>
+        /// Sets a callback for functions created from this template that receives a view over the call arguments ('FunctionArguments')
+        /// instead of a handle for every argument and 'this'.  Handles are only created for the arguments the callback asks for, and
+        /// primitive arguments can be read without creating any handles at all.
+        /// <para>If the callback returns an empty handle, the regular callbacks (see 'GetFunctionObject()') are called as well.  Pass
+        /// null to only use the regular callbacks again.</para>
+        /// </summary>
+        public void SetArgumentsCallback(JSArgumentsFunction callback)
+        {
+            if (_NativeFunctionTemplateProxy == null) throw new InvalidOperationException("The function template is not initialized.");
+
+            // ... the native delegate is created once and kept for the life of the template, so scripts calling it while it is being
+            // replaced (the native side does this under the isolate lock) never see a collected delegate; with no callback, it
+            // falls back to the regular callbacks ...
+
+            if (callback != null && _NativeArgumentsCallback == null)
+                _NativeArgumentsCallback = _SetDelegate<NativeFunctionArgsCallback>(_ArgumentsCallBack);
+            _ArgumentsCallback = callback;
+            V8NetProxy.SetFunctionTemplateArgsCallback(_NativeFunctionTemplateProxy, callback != null ? _NativeArgumentsCallback : null);
+        }
+
+        HandleProxy* _ArgumentsCallBack(Int32 managedObjectID, bool isConstructCall, NativeCallbackArguments* args, Int32 argCount)
+        {
+            try
+            {
+                var callback = _ArgumentsCallback;
+                InternalHandle result = callback != null ? callback(_Engine, isConstructCall, new FunctionArguments(_Engine, args, argCount)) : InternalHandle.Empty;
+                if (!result.IsEmpty)
+                    return result;
+
+                // ... fall back to the regular callbacks (the handles are only created now) ...
+
+                var _args = stackalloc HandleProxy*[argCount];
+                for (var i = 0; i < argCount; i++)
+                    _args[i] = V8NetProxy.GetCallbackArgument(args, i);
+
+                return _CallBack(managedObjectID, isConstructCall, V8NetProxy.GetCallbackThis(args), _args, argCount);
+            }
+            catch (Exception ex)
+            {
+                return _Engine.CreateError(Exceptions.GetFullErrorMessage(ex), JSValueType.ExecutionError);
+            }
+        }
+
+        /// <summary>
+        /// Sets a callback for functions created from this template that is called directly with primitive argument values: no handles
+        /// are created for the arguments, 'this', or the return value.  This is intended for small, frequently called helpers (math,
+        /// hashing, etc.).
+        /// <para>If a script passes arguments that don't match the signature (for example, a string, or a double where an Int32 is
+        /// expected), or calls the function using 'new', the regular callbacks (see 'GetFunctionObject()') are used instead.</para>
+        /// </summary>
+        public void SetPrimitiveCallback(PrimitiveNumberFunction callback) { _SetPrimitiveCallback(PrimitiveSignature.Number1, callback); }
+
+        /// <summary> Sets a primitive callback that takes two numbers (see 'SetPrimitiveCallback(PrimitiveNumberFunction)'). </summary>
+        public void SetPrimitiveCallback(PrimitiveNumberFunction2 callback) { _SetPrimitiveCallback(PrimitiveSignature.Number2, callback); }
+
+        /// <summary> Sets a primitive callback that takes one Int32 (see 'SetPrimitiveCallback(PrimitiveNumberFunction)'). </summary>
+        public void SetPrimitiveCallback(PrimitiveInt32Function callback) { _SetPrimitiveCallback(PrimitiveSignature.Int32_1, callback); }
+
+        /// <summary> Sets a primitive callback that takes two Int32 values (see 'SetPrimitiveCallback(PrimitiveNumberFunction)'). </summary>
+        public void SetPrimitiveCallback(PrimitiveInt32Function2 callback) { _SetPrimitiveCallback(PrimitiveSignature.Int32_2, callback); }
+
+        /// <summary> Sets a primitive callback that takes any number of numbers (see 'SetPrimitiveCallback(PrimitiveNumberFunction)'). </summary>
+        public void SetPrimitiveCallback(PrimitiveNumberArrayFunction callback) { _SetPrimitiveCallback(PrimitiveSignature.NumberArray, callback); }
+
+        /// <summary>
+        /// Removes any primitive callback, so all calls use the regular callbacks.
+        /// </summary>
+        public void ClearPrimitiveCallback() { _SetPrimitiveCallback(PrimitiveSignature.None, null); }
+
+        void _SetPrimitiveCallback(PrimitiveSignature signature, Delegate callback)
+        {
+            if (_NativeFunctionTemplateProxy == null) throw new InvalidOperationException("The function template is not initialized.");
+
+            // ... the native side replaces the callback under the isolate lock, so once the call returns no script can still be
+            // calling the previous delegate; until then it must stay alive (this call might even come from within it) ...
+
+            var previousCallback = _PrimitiveCallback;
+            var pointer = callback != null ? Marshal.GetFunctionPointerForDelegate(callback) : IntPtr.Zero;
+            _PrimitiveCallback = callback;
+            V8NetProxy.SetFunctionTemplatePrimitiveCallback(_NativeFunctionTemplateProxy, callback != null ? signature : PrimitiveSignature.None, (void*)pointer);
+            GC.KeepAlive(previousCallback);
+        }
+
+        // --------------------------------------------------------------------------------------------------------------------
+
         /// <summary>
         /// Calls the V8 'Set()' function on the underlying native function template to set properties that will exist on all function objects created from this template.
         /// </summary>
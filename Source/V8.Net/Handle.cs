@@ -651,6 +651,7 @@ namespace V8.Net
 
         public static implicit operator double(InternalHandle handle)
         {
+            if (handle.IsDate) return handle._DateMilliseconds;
             return (double)Types.ChangeType(handle.Value, typeof(double));
         }
 
@@ -661,7 +662,7 @@ namespace V8.Net
 
         public static implicit operator DateTime(InternalHandle handle)
         {
-            var ms = (double)Types.ChangeType(handle.Value, typeof(double));
+            var ms = handle.IsDate ? handle._DateMilliseconds : (double)Types.ChangeType(handle.Value, typeof(double));
             return new DateTime(1970, 1, 1) + TimeSpan.FromMilliseconds(ms);
         }
 
@@ -797,6 +798,7 @@ namespace V8.Net
         ///     GetProperty(Int32)).
         ///     <para>For objects, this returns the in-script type text as a string - unless this handle represents an object binder,
         ///     in which case this will return the bound object instead.</para>
+        ///     <para>Note: Rendering the text of dates and objects can be expensive; see 'ValueOrHandle' to avoid it.</para>
         /// </summary>
         /// <value> The value. </value>
         public object Value
@@ -814,13 +816,64 @@ namespace V8.Net
                         return argInfo.ValueOrDefault; // (this object represents a ArgInfo object, so return its value)
                     }
 
-                    V8NetProxy.UpdateHandleValue(_HandleProxy);
+                    if (_HandleProxy->ValueIsCurrent == 0) // (primitive values are usually filled in by the native side already)
+                        V8NetProxy.UpdateHandleValueText(_HandleProxy);
                     return _HandleProxy->Value;
                 }
                 else return null;
             }
         }
 
+        /// <summary>
+        /// Same as 'Value', except that no text is rendered for dates and objects: dates are returned as a UTC 'DateTime', and
+        /// objects (including functions, arrays, and regular expressions) return this handle.  This avoids converting the object to
+        /// a string on the native side (which can be expensive, and may even call back into script).
+        /// <para>Note: The handle returned for objects is this same handle (not a new one), so it is only valid while this handle is.</para>
+        /// </summary>
+        public object ValueOrHandle
+        {
+            get
+            {
+                if (_HandleProxy != null)
+                {
+                    if (IsBinder)
+                        return BoundObject;
+
+                    if (CLRTypeID >= 0)
+                    {
+                        var argInfo = new ArgInfo(Engine, this);
+                        return argInfo.ValueOrDefault; // (this object represents a ArgInfo object, so return its value)
+                    }
+
+                    if (_HandleProxy->ValueIsCurrent == 0)
+                        V8NetProxy.UpdateHandleValue(_HandleProxy);
+
+                    switch (_HandleProxy->_Type)
+                    {
+                        case JSValueType.Date: return V8Engine.Epoch + TimeSpan.FromMilliseconds(_HandleProxy->V8Number);
+                        case JSValueType.Object:
+                        case JSValueType.Function:
+                        case JSValueType.Array:
+                        case JSValueType.RegExp: return this;
+                        default: return _HandleProxy->Value;
+                    }
+                }
+                else return null;
+            }
+        }
+
+        /// <summary>
+        /// Reads the milliseconds (since epoch) of a date handle without rendering the date text.
+        /// </summary>
+        double _DateMilliseconds
+        {
+            get
+            {
+                V8NetProxy.UpdateHandleValue(_HandleProxy);
+                return _HandleProxy->V8Number;
+            }
+        }
+
         /// <summary>
         ///     Reading from this property returns either the underlying managed object, or else causes a ONE-TIME native call to
         ///     fetch the current V8 value associated with this handle. This can be a bit faster, as subsequent calls return the
@@ -845,8 +898,8 @@ namespace V8.Net
                         return argInfo.ValueOrDefault; // (this object represents a ArgInfo object, so return its value)
                     }
 
-                    if (_HandleProxy->_Type != JSValueType.Uninitialized)
-                        V8NetProxy.UpdateHandleValue(_HandleProxy);
+                    if (_HandleProxy->_Type != JSValueType.Uninitialized && _HandleProxy->ValueIsCurrent == 0)
+                        V8NetProxy.UpdateHandleValueText(_HandleProxy);
                     return _HandleProxy->Value;
                 }
                 else return null;
@@ -859,6 +912,262 @@ namespace V8.Net
         /// </summary>
         public Int32 ArrayLength { get { return IsArray ? V8NetProxy.GetArrayLength(_HandleProxy) : 0; } }
 
+        /// <summary>
+        /// Reads numeric elements of the array (or typed array) this handle represents into the given buffer in a single native call,
+        /// and returns the number of elements read (or -1 if this handle is not an array or typed array).  Elements that are not
+        /// numbers are read as NaN.  Elements of 'Float64Array' typed arrays are copied directly.
+        /// </summary>
+        /// <param name="start"> The index of the first element to read. </param>
+        /// <param name="buffer"> The buffer to copy the values into. </param>
+        /// <param name="index"> The position in 'buffer' to start writing to. </param>
+        /// <param name="count"> The maximum number of elements to read. </param>
+        public Int32 ReadArray(Int32 start, double[] buffer, Int32 index, Int32 count)
+        {
+            if (buffer == null) throw new ArgumentNullException(nameof(buffer));
+            if (index < 0 || count < 0 || index + count > buffer.Length) throw new ArgumentOutOfRangeException(nameof(count));
+            if (_HandleProxy == null) return -1;
+            if (count == 0) return 0;
+            fixed (double* p = &buffer[index])
+                return V8NetProxy.ReadArrayNumbers(_HandleProxy, start, p, count);
+        }
+
+        /// <summary>
+        /// Reads numeric elements of the array (or typed array) this handle represents into the given buffer as 32-bit integers in a
+        /// single native call, and returns the number of elements read (or -1 if this handle is not an array or typed array).
+        /// Numbers are converted the same as 'x|0' in script, and elements that are not numbers are read as 0.  Elements of
+        /// 'Int32Array' typed arrays are copied directly.
+        /// </summary>
+        /// <param name="start"> The index of the first element to read. </param>
+        /// <param name="buffer"> The buffer to copy the values into. </param>
+        /// <param name="index"> The position in 'buffer' to start writing to. </param>
+        /// <param name="count"> The maximum number of elements to read. </param>
+        public Int32 ReadArray(Int32 start, Int32[] buffer, Int32 index, Int32 count)
+        {
+            if (buffer == null) throw new ArgumentNullException(nameof(buffer));
+            if (index < 0 || count < 0 || index + count > buffer.Length) throw new ArgumentOutOfRangeException(nameof(count));
+            if (_HandleProxy == null) return -1;
+            if (count == 0) return 0;
+            fixed (Int32* p = &buffer[index])
+                return V8NetProxy.ReadArrayIntegers(_HandleProxy, start, p, count);
+        }
+
+        /// <summary>
+        /// Reads a range of elements of the array this handle represents in a single native call.  Values are returned the same as
+        /// for 'GetProperties()' (any value that is not a primitive is returned as an 'InternalHandle' the caller must dispose).
+        /// </summary>
+        /// <param name="start"> The index of the first element to read. </param>
+        /// <param name="count"> The number of elements to read (-1 to read to the end of the array). </param>
+        public object[] GetArrayValues(Int32 start = 0, Int32 count = -1)
+        {
+            if (!IsArray)
+                throw new InvalidOperationException("The handle does not represent an array.");
+
+            if (count < 0)
+                count = Math.Max(ArrayLength - start, 0);
+
+            var values = new PrimitiveValue[count];
+            var result = new object[count];
+            HandleProxy* error;
+
+            fixed (PrimitiveValue* pValues = values)
+            {
+                error = V8NetProxy.GetArrayValues(this, start, count, pValues);
+                try
+                {
+                    for (var i = 0; i < values.Length; i++)
+                        result[i] = values[i].Value;
+                }
+                finally { V8NetProxy.FreePrimitiveValues(pValues, values.Length); }
+            }
+
+            if (error != null)
+            {
+                foreach (var value in result)
+                    if (value is InternalHandle)
+                        ((InternalHandle)value).Dispose();
+
+                using (var hError = new InternalHandle(error, true))
+                    hError.ThrowOnError();
+            }
+
+            return result;
+        }
+
+        /// <summary>
+        /// Gets the memory of the ArrayBuffer this handle represents (or the part of the buffer a typed array or DataView covers), so
+        /// binary data can be read or written without copying it.  Returns false if this handle is not an array buffer or view.
+        /// <para>Note: The memory is only valid while the buffer is referenced (keep this handle alive while using it).</para>
+        /// </summary>
+        public bool GetArrayBufferContents(out IntPtr data, out Int64 length)
+        {
+            void* pData = null;
+            Int64 len = 0;
+            var result = _HandleProxy != null && V8NetProxy.GetArrayBufferContents(_HandleProxy, &pData, &len);
+            data = (IntPtr)pData;
+            length = len;
+            return result;
+        }
+
+        /// <summary>
+        /// Sets the memory read and written by direct accessors on an object created from an object template (see
+        /// 'ObjectTemplate.SetDirectAccessor()').  The memory must stay valid (pinned) until it is replaced, or the object is no
+        /// longer used by scripts.  Pass 'IntPtr.Zero' to clear it.
+        /// </summary>
+        public void SetDataPointer(IntPtr data)
+        {
+            if (_HandleProxy == null) throw new InvalidOperationException("The handle is empty.");
+            if (!V8NetProxy.SetObjectDataPointer(_HandleProxy, (void*)data))
+                throw new InvalidOperationException("The data pointer could not be set: the object was not created from an object template, or the pointer is not aligned.");
+        }
+
+        /// <summary>
+        /// Removes a property value cached for an object created from an object template (see 'IV8CacheableProperties'), so the next
+        /// read calls back into managed code again.  If 'name' is null, all cached values for the object are removed.
+        /// </summary>
+        public void InvalidatePropertyCache(string name = null)
+        {
+            if (_HandleProxy != null)
+                V8NetProxy.InvalidatePropertyCache(_HandleProxy, name);
+        }
+
+        /// <summary>
+        /// Returns the string length (in UTF16 characters) for handles that represent strings. For all other types, this returns -1.
+        /// </summary>
+        public Int32 StringLength { get { return _HandleProxy != null ? V8NetProxy.GetStringLength(_HandleProxy) : -1; } }
+
+        /// <summary>
+        /// Copies a range of characters from the V8 string this handle represents into the given buffer, and returns the number of
+        /// characters copied (or -1 if this handle is not a string).  Very large strings can be read in chunks this way without
+        /// copying the whole string into managed memory at once (as reading 'Value' would).
+        /// </summary>
+        /// <param name="start"> The character position in the V8 string to start reading from. </param>
+        /// <param name="buffer"> The buffer to copy the characters into. </param>
+        /// <param name="index"> The position in 'buffer' to start writing to. </param>
+        /// <param name="count"> The maximum number of characters to read. </param>
+        public Int32 ReadString(Int32 start, char[] buffer, Int32 index, Int32 count)
+        {
+            if (buffer == null) throw new ArgumentNullException(nameof(buffer));
+            if (index < 0 || count < 0 || index + count > buffer.Length) throw new ArgumentOutOfRangeException(nameof(count));
+            if (_HandleProxy == null) return -1;
+            if (count == 0) return 0;
+            fixed (char* p = &buffer[index])
+                return V8NetProxy.ReadString(_HandleProxy, p, start, count);
+        }
+
+        /// <summary>
+        /// Streams the V8 string this handle represents to the given writer in chunks of 'chunkSize' characters.
+        /// Returns false if this handle is not a string.
+        /// </summary>
+        public bool WriteString(System.IO.TextWriter writer, Int32 chunkSize = 64 * 1024)
+        {
+            if (writer == null) throw new ArgumentNullException(nameof(writer));
+            if (chunkSize <= 0) throw new ArgumentOutOfRangeException(nameof(chunkSize));
+            var length = StringLength;
+            if (length < 0) return false;
+            var buffer = new char[Math.Min(chunkSize, Math.Max(length, 1))];
+            for (Int32 pos = 0, read; pos < length; pos += read)
+            {
+                read = ReadString(pos, buffer, 0, buffer.Length);
+                if (read <= 0) break;
+                writer.Write(buffer, 0, read);
+            }
+            return true;
+        }
+
+        // --------------------------------------------------------------------------------------------------------------------
+
+        /// <summary>
+        /// Converts the underlying value to JSON text using the native V8 JSON serializer (the same as 'JSON.stringify()' in
+        /// script).  Throws an exception if the value cannot be converted (for instance, if it contains a cycle).
+        /// </summary>
+        /// <param name="gap"> (Optional) The string used to indent nested values (no whitespace is added if null). </param>
+        public string ToJSON(string gap = null)
+        {
+            if (_HandleProxy == null) throw new InvalidOperationException("The handle is empty.");
+
+            const Int32 bufferSize = 1024;
+            char* buffer = stackalloc char[bufferSize];
+            Int32 length;
+
+            _ThrowJSONError(V8NetProxy.StringifyJSON(_HandleProxy, gap, false, buffer, bufferSize, &length, null));
+
+            if (length <= bufferSize)
+                return new string(buffer, 0, length);
+
+            // ... too large for the stack buffer, so ask again with a buffer of the right size ...
+
+            var text = new char[length];
+            fixed (char* pText = text)
+                _ThrowJSONError(V8NetProxy.StringifyJSON(_HandleProxy, gap, false, pText, text.Length, &length, null));
+
+            return new string(text, 0, Math.Min(length, text.Length));
+        }
+
+        /// <summary>
+        /// Converts the underlying value to JSON text using the native V8 JSON serializer, and streams the text to the given writer
+        /// in chunks (the whole text is never copied into a managed string).
+        /// </summary>
+        /// <param name="gap"> (Optional) The string used to indent nested values (no whitespace is added if null). </param>
+        public void WriteJSON(System.IO.TextWriter writer, string gap = null)
+        {
+            if (writer == null) throw new ArgumentNullException(nameof(writer));
+            var buffer = new char[1024];
+            _WriteJSON(gap, false, (data, length) =>
+            {
+                for (Int32 pos = 0, count; pos < length; pos += count)
+                {
+                    count = Math.Min(length - pos, buffer.Length);
+                    Marshal.Copy((IntPtr)((char*)data + pos), buffer, 0, count);
+                    writer.Write(buffer, 0, count);
+                }
+            });
+        }
+
+        /// <summary>
+        /// Converts the underlying value to JSON text using the native V8 JSON serializer, and streams the text to the given stream
+        /// as UTF-8 bytes in chunks (the text is encoded on the native side).
+        /// </summary>
+        /// <param name="gap"> (Optional) The string used to indent nested values (no whitespace is added if null). </param>
+        public void WriteJSON(System.IO.Stream stream, string gap = null)
+        {
+            if (stream == null) throw new ArgumentNullException(nameof(stream));
+            var buffer = new byte[4096];
+            _WriteJSON(gap, true, (data, length) =>
+            {
+                for (Int32 pos = 0, count; pos < length; pos += count)
+                {
+                    count = Math.Min(length - pos, buffer.Length);
+                    Marshal.Copy((IntPtr)((byte*)data + pos), buffer, 0, count);
+                    stream.Write(buffer, 0, count);
+                }
+            });
+        }
+
+        void _WriteJSON(string gap, bool utf8, Action<IntPtr, Int32> write)
+        {
+            if (_HandleProxy == null) throw new InvalidOperationException("The handle is empty.");
+
+            Exception error = null;
+            NativeWriteCallback callback = (data, length) =>
+            {
+                try { write((IntPtr)data, length); return true; }
+                catch (Exception ex) { error = ex; return false; } // (exceptions cannot pass through the native side)
+            };
+
+            Int32 written;
+            var result = V8NetProxy.StringifyJSON(_HandleProxy, gap, utf8, null, 0, &written, callback);
+            GC.KeepAlive(callback);
+
+            if (error != null) throw error;
+            _ThrowJSONError(result);
+        }
+
+        static void _ThrowJSONError(HandleProxy* result)
+        {
+            if (result != null)
+                ((InternalHandle)result).ThrowOnError();
+        }
+
         // --------------------------------------------------------------------------------------------------------------------
 
         ///// <summary>
@@ -1022,6 +1331,15 @@ namespace V8.Net
         /// </summary>
         public IJSProperty AsJSProperty() { return (JSProperty)this; }
 
+        /// <summary>
+        /// Reads the underlying value, and any objects and arrays it references, into managed values using a single native call
+        /// (see <see cref="ObjectSerializer"/> for how values are converted).  This is much faster than reading properties one at a
+        /// time when the whole object graph is needed.
+        /// </summary>
+        /// <param name="maxDepth"> The maximum nesting depth of objects and arrays. </param>
+        /// <param name="maxSize"> The maximum size of the serialized data in bytes (0 for no limit). </param>
+        public object AsManagedGraph(Int32 maxDepth = ObjectSerializer.DefaultMaxDepth, Int32 maxSize = 0) { return ObjectSerializer.Read(this, maxDepth, maxSize); }
+
         // --------------------------------------------------------------------------------------------------------------------
 
         public string DisposalStatus
@@ -1201,6 +1519,25 @@ namespace V8.Net
         /// </summary>
         public bool WasTerminated { get { return ValueType == JSValueType.ExecutionTerminated; } }
 
+        /// <summary>
+        /// Gets the line and column for handles that represent script errors.  Returns false if the location is not known (such
+        /// as for errors created on the managed side).
+        /// <para>Note: Unlike reading 'Value' for an error handle, this does not format the full error text.</para>
+        /// </summary>
+        public bool GetErrorLocation(out Int32 line, out Int32 column)
+        {
+            line = column = -1;
+            return _HandleProxy != null && V8NetProxy.GetErrorLocation(_HandleProxy, out line, out column);
+        }
+
+        /// <summary>
+        /// Returns part of a script error as a new handle, or an empty handle if this is not a script error or the part is not available.
+        /// </summary>
+        public InternalHandle GetErrorField(ScriptErrorField field)
+        {
+            return _HandleProxy != null ? (InternalHandle)V8NetProxy.GetErrorField(_HandleProxy, field) : InternalHandle.Empty;
+        }
+
         // --------------------------------------------------------------------------------------------------------------------
         // DynamicObject support is in .NET 4.0 and higher
 
@@ -1417,6 +1754,81 @@ namespace V8.Net
             return new InternalHandle(V8NetProxy.GetObjectPropertyByName(this, name), true);
         }
 
+        /// <summary>
+        /// Reads a number of properties from the underlying native object in a single native call.  Primitive values are returned
+        /// as CLR values (undefined and null both return null, and dates return 'DateTime' values).  Any other value is returned as
+        /// an 'InternalHandle', which the caller is responsible for disposing.
+        /// </summary>
+        public object[] GetProperties(params string[] names)
+        {
+            if (names == null) throw new ArgumentNullException(nameof(names));
+
+            if (!IsObjectType)
+                throw new InvalidOperationException(_NOT_AN_OBJECT_ERRORMSG);
+
+            var values = new PrimitiveValue[names.Length];
+            var result = new object[names.Length];
+            HandleProxy* error;
+
+            fixed (PrimitiveValue* pValues = values)
+            {
+                error = V8NetProxy.GetObjectProperties(this, names, names.Length, pValues);
+                try
+                {
+                    for (var i = 0; i < values.Length; i++)
+                        result[i] = values[i].Value;
+                }
+                finally { V8NetProxy.FreePrimitiveValues(pValues, values.Length); }
+            }
+
+            if (error != null)
+            {
+                foreach (var value in result)
+                    if (value is InternalHandle)
+                        ((InternalHandle)value).Dispose();
+
+                using (var hError = new InternalHandle(error, true))
+                    hError.ThrowOnError();
+            }
+
+            return result;
+        }
+
+        /// <summary>
+        /// Sets a number of properties on the underlying native object in a single native call.  The supported value types are
+        /// listed on 'PrimitiveValue.From()'.
+        /// </summary>
+        public void SetProperties(string[] names, object[] values, V8PropertyAttributes attributes = V8PropertyAttributes.None)
+        {
+            if (names == null) throw new ArgumentNullException(nameof(names));
+            if (values == null) throw new ArgumentNullException(nameof(values));
+            if (names.Length != values.Length) throw new ArgumentException("The number of names and values must be the same.", nameof(values));
+
+            if (!IsObjectType)
+                throw new InvalidOperationException(_NOT_AN_OBJECT_ERRORMSG);
+
+            var pValues = new PrimitiveValue[values.Length];
+            HandleProxy* error;
+
+            try
+            {
+                for (var i = 0; i < values.Length; i++)
+                    pValues[i] = PrimitiveValue.From(values[i]);
+
+                fixed (PrimitiveValue* p = pValues)
+                    error = V8NetProxy.SetObjectProperties(this, names, p, names.Length, attributes);
+            }
+            finally
+            {
+                for (var i = 0; i < pValues.Length; i++)
+                    pValues[i].Free();
+            }
+
+            if (error != null)
+                using (var hError = new InternalHandle(error, true))
+                    hError.ThrowOnError();
+        }
+
         /// <summary>
         /// Calls the V8 'Get()' function on the underlying native object.
         /// If the property doesn't exist, the 'IsUndefined' property will be true.
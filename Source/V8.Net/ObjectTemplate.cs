@@ -126,6 +126,8 @@ namespace V8.Net
                     return null;
                 var mo = obj as IV8ManagedObject;
                 var result = mo != null ? mo.NamedPropertyGetter(ref propertyName) : null;
+                if (!result.IsEmpty && !result.IsError && obj is IV8CacheableProperties cacheable && cacheable.IsPropertyCacheable(propertyName, result))
+                    info.ResultFlags |= ManagedAccessorResultFlags.Cacheable;
                 return result;
             }
             catch (Exception ex)
@@ -542,6 +544,64 @@ namespace V8.Net
             V8NetProxy.SetObjectTemplateAccessor(_NativeObjectTemplateProxy, -1, name, _Getter, _Setter, access, attributes);
         }
 
+        /// <summary>
+        /// Creates a property on all objects created from this template that reads and writes a value in memory directly, without
+        /// calling back into managed code.  The value is at 'offset' bytes from the data pointer of each object (see
+        /// 'InternalHandle.SetDataPointer()'); the property is undefined for objects without a data pointer.
+        /// <para>Include 'V8PropertyAttributes.ReadOnly' in 'attributes' to ignore writes from scripts.</para>
+        /// </summary>
+        public void SetDirectAccessor(string name, Int32 offset, DirectAccessorType type, V8PropertyAttributes attributes = V8PropertyAttributes.None)
+        {
+            if (name.IsNullOrWhiteSpace()) throw new ArgumentNullException("name (cannot be null, empty, or only whitespace)");
+            if (offset < 0) throw new ArgumentOutOfRangeException(nameof(offset));
+
+            V8NetProxy.SetObjectTemplateDirectAccessor(_NativeObjectTemplateProxy, name, offset, type, attributes);
+        }
+
+        /// <summary>
+        /// Creates a direct accessor (see <see cref="SetDirectAccessor(string, int, DirectAccessorType, V8PropertyAttributes)"/>) for
+        /// a field of a struct, using the field's offset and type.  The data pointer of each object is expected to point to an
+        /// instance of 'T'.
+        /// <para>Note: 'T' must be blittable (no references, 'bool', or 'char' fields anywhere in it), since only then does its
+        /// marshaled layout match the pinned memory the data pointer refers to; other types throw 'NotSupportedException'.  For
+        /// boolean flags, use a 'byte' field, or the overload that takes an offset with 'DirectAccessorType.Boolean'.</para>
+        /// </summary>
+        /// <param name="name"> The property name (defaults to the field name). </param>
+        public void SetDirectAccessor<T>(string fieldName, string name = null, V8PropertyAttributes attributes = V8PropertyAttributes.None) where T : struct
+        {
+            var field = typeof(T).GetField(fieldName, BindingFlags.Instance | BindingFlags.Public | BindingFlags.NonPublic);
+            if (field == null) throw new ArgumentException("'" + typeof(T).Name + "' has no field named '" + fieldName + "'.", nameof(fieldName));
+
+            if (!_IsBlittable(typeof(T)))
+                throw new NotSupportedException("Direct accessors require a blittable struct, but '" + typeof(T).Name + "' contains references or 'bool'/'char' fields, so its field offsets are unknown.");
+
+            DirectAccessorType type;
+            var fieldType = field.FieldType.IsEnum ? Enum.GetUnderlyingType(field.FieldType) : field.FieldType;
+
+            if (fieldType == typeof(byte)) type = DirectAccessorType.Byte;
+            else if (fieldType == typeof(Int16)) type = DirectAccessorType.Int16;
+            else if (fieldType == typeof(UInt16)) type = DirectAccessorType.UInt16;
+            else if (fieldType == typeof(Int32)) type = DirectAccessorType.Int32;
+            else if (fieldType == typeof(UInt32)) type = DirectAccessorType.UInt32;
+            else if (fieldType == typeof(Int64)) type = DirectAccessorType.Int64;
+            else if (fieldType == typeof(float)) type = DirectAccessorType.Float;
+            else if (fieldType == typeof(double)) type = DirectAccessorType.Double;
+            else throw new NotSupportedException("Direct accessors do not support fields of type '" + field.FieldType.Name + "'.");
+
+            SetDirectAccessor(name ?? fieldName, (Int32)Marshal.OffsetOf(typeof(T), fieldName), type, attributes);
+        }
+
+        static bool _IsBlittable(Type type)
+        {
+            try
+            {
+                // ... the runtime only allows pinning objects with blittable data, so this is the most reliable test ...
+                GCHandle.Alloc(Activator.CreateInstance(type), GCHandleType.Pinned).Free();
+                return true;
+            }
+            catch (ArgumentException) { return false; }
+        }
+
         // --------------------------------------------------------------------------------------------------------------------
     }
 
@@ -6,16 +6,42 @@ namespace V8.Net
 {
     public unsafe static partial class V8NetProxy
     {
+        [DllImport("V8_Net_Proxy_x86", EntryPoint = "ConfigurePlatform")]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern bool ConfigurePlatform32(PlatformOptions* options);
+        public delegate bool ConfigurePlatform_ImportFuncType(PlatformOptions* options);
+        public static ConfigurePlatform_ImportFuncType ConfigurePlatform = (Environment.Is64BitProcess ? (ConfigurePlatform_ImportFuncType)ConfigurePlatform64 : ConfigurePlatform32);
+
+        [DllImport("V8_Net_Proxy_x86", EntryPoint = "GetPlatformStats")]
+        public static extern void GetPlatformStats32(PlatformStats* stats);
+        public delegate void GetPlatformStats_ImportFuncType(PlatformStats* stats);
+        public static GetPlatformStats_ImportFuncType GetPlatformStats = (Environment.Is64BitProcess ? (GetPlatformStats_ImportFuncType)GetPlatformStats64 : GetPlatformStats32);
+
         [DllImport("V8_Net_Proxy_x86", EntryPoint = "CreateV8EngineProxy")]
         public extern static NativeV8EngineProxy* CreateV8EngineProxy32(bool enableDebugging, void* debugMessageDispatcher, int debugPort);
         public delegate NativeV8EngineProxy* CreateV8EngineProxy_ImportFuncType(bool enableDebugging, void* debugMessageDispatcher, int debugPort);
         public static CreateV8EngineProxy_ImportFuncType CreateV8EngineProxy = (Environment.Is64BitProcess ? (CreateV8EngineProxy_ImportFuncType)CreateV8EngineProxy64 : CreateV8EngineProxy32);
 
+        [DllImport("V8_Net_Proxy_x86", EntryPoint = "CreateV8EngineProxyEx")]
+        public extern static NativeV8EngineProxy* CreateV8EngineProxyEx32(bool enableDebugging, void* debugMessageDispatcher, int debugPort, V8EngineFlags flags);
+        public delegate NativeV8EngineProxy* CreateV8EngineProxyEx_ImportFuncType(bool enableDebugging, void* debugMessageDispatcher, int debugPort, V8EngineFlags flags);
+        public static CreateV8EngineProxyEx_ImportFuncType CreateV8EngineProxyEx = (Environment.Is64BitProcess ? (CreateV8EngineProxyEx_ImportFuncType)CreateV8EngineProxyEx64 : CreateV8EngineProxyEx32);
+
         [DllImport("V8_Net_Proxy_x86", EntryPoint = "DestroyV8EngineProxy", ExactSpelling = false)]
         public static extern void DestroyV8EngineProxy32(NativeV8EngineProxy* engine);
         public delegate void DestroyV8EngineProxy_ImportFuncType(NativeV8EngineProxy* engine);
         public static DestroyV8EngineProxy_ImportFuncType DestroyV8EngineProxy = (Environment.Is64BitProcess ? (DestroyV8EngineProxy_ImportFuncType)DestroyV8EngineProxy64 : DestroyV8EngineProxy32);
 
+        [DllImport("V8_Net_Proxy_x86", EntryPoint = "BeginSession")]
+        public static extern Int32 BeginSession32(NativeV8EngineProxy* engine);
+        public delegate Int32 BeginSession_ImportFuncType(NativeV8EngineProxy* engine);
+        public static BeginSession_ImportFuncType BeginSession = (Environment.Is64BitProcess ? (BeginSession_ImportFuncType)BeginSession64 : BeginSession32);
+
+        [DllImport("V8_Net_Proxy_x86", EntryPoint = "EndSession")]
+        public static extern Int32 EndSession32(NativeV8EngineProxy* engine);
+        public delegate Int32 EndSession_ImportFuncType(NativeV8EngineProxy* engine);
+        public static EndSession_ImportFuncType EndSession = (Environment.Is64BitProcess ? (EndSession_ImportFuncType)EndSession64 : EndSession32);
+
         [DllImport("V8_Net_Proxy_x86", EntryPoint = "CreateContext")]
         public extern static NativeContext* CreateContext32(NativeV8EngineProxy* engine, NativeObjectTemplateProxy* templatePoxy);
         public delegate NativeContext* CreateContext_ImportFuncType(NativeV8EngineProxy* engine, NativeObjectTemplateProxy* templatePoxy);
@@ -76,6 +102,11 @@ namespace V8.Net
         public delegate void TerminateExecution_ImportFuncType(NativeV8EngineProxy* engine);
         public static TerminateExecution_ImportFuncType TerminateExecution = (Environment.Is64BitProcess ? (TerminateExecution_ImportFuncType)TerminateExecution64 : TerminateExecution32);
 
+        [DllImport("V8_Net_Proxy_x86", EntryPoint = "GetArgumentBufferStats")]
+        public static extern void GetArgumentBufferStats32(NativeV8EngineProxy* engine, out ArgumentBufferStats stats);
+        public delegate void GetArgumentBufferStats_ImportFuncType(NativeV8EngineProxy* engine, out ArgumentBufferStats stats);
+        public static GetArgumentBufferStats_ImportFuncType GetArgumentBufferStats = (Environment.Is64BitProcess ? (GetArgumentBufferStats_ImportFuncType)GetArgumentBufferStats64 : GetArgumentBufferStats32);
+
         [DllImport("V8_Net_Proxy_x86", EntryPoint = "CreateObjectTemplateProxy")]
         public static unsafe extern NativeObjectTemplateProxy* CreateObjectTemplateProxy32(NativeV8EngineProxy* engine);
         public delegate NativeObjectTemplateProxy* CreateObjectTemplateProxy_ImportFuncType(NativeV8EngineProxy* engine);
@@ -145,6 +176,11 @@ namespace V8.Net
         public delegate void ConnectObject_ImportFuncType(HandleProxy* handleProxy, Int32 objID, void* templateProxy = null);
         public static ConnectObject_ImportFuncType ConnectObject = (Environment.Is64BitProcess ? (ConnectObject_ImportFuncType)ConnectObject64 : ConnectObject32);
 
+        [DllImport("V8_Net_Proxy_x86", EntryPoint = "SetObjectCLRTypeID")]
+        public static unsafe extern bool SetObjectCLRTypeID32(HandleProxy* handleProxy, Int32 typeID);
+        public delegate bool SetObjectCLRTypeID_ImportFuncType(HandleProxy* handleProxy, Int32 typeID);
+        public static SetObjectCLRTypeID_ImportFuncType SetObjectCLRTypeID = (Environment.Is64BitProcess ? (SetObjectCLRTypeID_ImportFuncType)SetObjectCLRTypeID64 : SetObjectCLRTypeID32);
+
         [DllImport("V8_Net_Proxy_x86", EntryPoint = "GetObjectPrototype")]
         public static unsafe extern HandleProxy* GetObjectPrototype32(HandleProxy* handleProxy);
         public delegate HandleProxy* GetObjectPrototype_ImportFuncType(HandleProxy* handleProxy);
@@ -164,6 +200,21 @@ namespace V8.Net
         public delegate bool SetObjectPropertyByName_ImportFuncType(HandleProxy* proxy, string name, HandleProxy* value, V8PropertyAttributes attributes = V8PropertyAttributes.None);
         public static SetObjectPropertyByName_ImportFuncType SetObjectPropertyByName = (Environment.Is64BitProcess ? (SetObjectPropertyByName_ImportFuncType)SetObjectPropertyByName64 : SetObjectPropertyByName32);
 
+        [DllImport("V8_Net_Proxy_x86", EntryPoint = "GetObjectProperties", CharSet = CharSet.Unicode)]
+        public static unsafe extern HandleProxy* GetObjectProperties32(HandleProxy* proxy, [MarshalAs(UnmanagedType.LPArray, ArraySubType = UnmanagedType.LPWStr)] string[] names, Int32 count, PrimitiveValue* values);
+        public delegate HandleProxy* GetObjectProperties_ImportFuncType(HandleProxy* proxy, [MarshalAs(UnmanagedType.LPArray, ArraySubType = UnmanagedType.LPWStr)] string[] names, Int32 count, PrimitiveValue* values);
+        public static GetObjectProperties_ImportFuncType GetObjectProperties = (Environment.Is64BitProcess ? (GetObjectProperties_ImportFuncType)GetObjectProperties64 : GetObjectProperties32);
+
+        [DllImport("V8_Net_Proxy_x86", EntryPoint = "SetObjectProperties", CharSet = CharSet.Unicode)]
+        public static unsafe extern HandleProxy* SetObjectProperties32(HandleProxy* proxy, [MarshalAs(UnmanagedType.LPArray, ArraySubType = UnmanagedType.LPWStr)] string[] names, PrimitiveValue* values, Int32 count, V8PropertyAttributes attributes = V8PropertyAttributes.None);
+        public delegate HandleProxy* SetObjectProperties_ImportFuncType(HandleProxy* proxy, [MarshalAs(UnmanagedType.LPArray, ArraySubType = UnmanagedType.LPWStr)] string[] names, PrimitiveValue* values, Int32 count, V8PropertyAttributes attributes = V8PropertyAttributes.None);
+        public static SetObjectProperties_ImportFuncType SetObjectProperties = (Environment.Is64BitProcess ? (SetObjectProperties_ImportFuncType)SetObjectProperties64 : SetObjectProperties32);
+
+        [DllImport("V8_Net_Proxy_x86", EntryPoint = "FreePrimitiveValues")]
+        public static unsafe extern void FreePrimitiveValues32(PrimitiveValue* values, Int32 count);
+        public delegate void FreePrimitiveValues_ImportFuncType(PrimitiveValue* values, Int32 count);
+        public static FreePrimitiveValues_ImportFuncType FreePrimitiveValues = (Environment.Is64BitProcess ? (FreePrimitiveValues_ImportFuncType)FreePrimitiveValues64 : FreePrimitiveValues32);
+
         [DllImport("V8_Net_Proxy_x86", EntryPoint = "SetObjectPropertyByIndex")]
         public static unsafe extern bool SetObjectPropertyByIndex32(HandleProxy* proxy, Int32 index, HandleProxy* value, V8PropertyAttributes attributes = V8PropertyAttributes.None);
         public delegate bool SetObjectPropertyByIndex_ImportFuncType(HandleProxy* proxy, Int32 index, HandleProxy* value, V8PropertyAttributes attributes = V8PropertyAttributes.None);
@@ -211,6 +262,27 @@ namespace V8.Net
             V8AccessControl access, V8PropertyAttributes attributes);
         public static SetObjectTemplateAccessor_ImportFuncType SetObjectTemplateAccessor = (Environment.Is64BitProcess ? (SetObjectTemplateAccessor_ImportFuncType)SetObjectTemplateAccessor64 : SetObjectTemplateAccessor32);
 
+        [DllImport("V8_Net_Proxy_x86", EntryPoint = "SetObjectTemplateDirectAccessor", CharSet = CharSet.Unicode)]
+        public static unsafe extern void SetObjectTemplateDirectAccessor32(NativeObjectTemplateProxy* proxy, string name, Int32 offset, DirectAccessorType type, V8PropertyAttributes attributes);
+        public delegate void SetObjectTemplateDirectAccessor_ImportFuncType(NativeObjectTemplateProxy* proxy, string name, Int32 offset, DirectAccessorType type, V8PropertyAttributes attributes);
+        public static SetObjectTemplateDirectAccessor_ImportFuncType SetObjectTemplateDirectAccessor = (Environment.Is64BitProcess ? (SetObjectTemplateDirectAccessor_ImportFuncType)SetObjectTemplateDirectAccessor64 : SetObjectTemplateDirectAccessor32);
+
+        [DllImport("V8_Net_Proxy_x86", EntryPoint = "SetObjectDataPointer")]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static unsafe extern bool SetObjectDataPointer32(HandleProxy* proxy, void* data);
+        public delegate bool SetObjectDataPointer_ImportFuncType(HandleProxy* proxy, void* data);
+        public static SetObjectDataPointer_ImportFuncType SetObjectDataPointer = (Environment.Is64BitProcess ? (SetObjectDataPointer_ImportFuncType)SetObjectDataPointer64 : SetObjectDataPointer32);
+
+        [DllImport("V8_Net_Proxy_x86", EntryPoint = "InvalidatePropertyCache", CharSet = CharSet.Unicode)]
+        public static unsafe extern void InvalidatePropertyCache32(HandleProxy* proxy, string name);
+        public delegate void InvalidatePropertyCache_ImportFuncType(HandleProxy* proxy, string name);
+        public static InvalidatePropertyCache_ImportFuncType InvalidatePropertyCache = (Environment.Is64BitProcess ? (InvalidatePropertyCache_ImportFuncType)InvalidatePropertyCache64 : InvalidatePropertyCache32);
+
+        [DllImport("V8_Net_Proxy_x86", EntryPoint = "InvalidateAllPropertyCaches")]
+        public static unsafe extern void InvalidateAllPropertyCaches32(NativeV8EngineProxy* engine);
+        public delegate void InvalidateAllPropertyCaches_ImportFuncType(NativeV8EngineProxy* engine);
+        public static InvalidateAllPropertyCaches_ImportFuncType InvalidateAllPropertyCaches = (Environment.Is64BitProcess ? (InvalidateAllPropertyCaches_ImportFuncType)InvalidateAllPropertyCaches64 : InvalidateAllPropertyCaches32);
+
         [DllImport("V8_Net_Proxy_x86", EntryPoint = "SetObjectTemplateProperty", CharSet = CharSet.Unicode)]
         public static unsafe extern void SetObjectTemplateProperty32(NativeObjectTemplateProxy* proxy, string name, HandleProxy* value, V8PropertyAttributes attributes = V8PropertyAttributes.None);
         public delegate void SetObjectTemplateProperty_ImportFuncType(NativeObjectTemplateProxy* proxy, string name, HandleProxy* value, V8PropertyAttributes attributes = V8PropertyAttributes.None);
@@ -236,6 +308,21 @@ namespace V8.Net
         public delegate Int32 GetArrayLength_ImportFuncType(HandleProxy* proxy);
         public static GetArrayLength_ImportFuncType GetArrayLength = (Environment.Is64BitProcess ? (GetArrayLength_ImportFuncType)GetArrayLength64 : GetArrayLength32);
 
+        [DllImport("V8_Net_Proxy_x86", EntryPoint = "ReadArrayNumbers")]
+        public static unsafe extern Int32 ReadArrayNumbers32(HandleProxy* proxy, Int32 start, double* buffer, Int32 count);
+        public delegate Int32 ReadArrayNumbers_ImportFuncType(HandleProxy* proxy, Int32 start, double* buffer, Int32 count);
+        public static ReadArrayNumbers_ImportFuncType ReadArrayNumbers = (Environment.Is64BitProcess ? (ReadArrayNumbers_ImportFuncType)ReadArrayNumbers64 : ReadArrayNumbers32);
+
+        [DllImport("V8_Net_Proxy_x86", EntryPoint = "ReadArrayIntegers")]
+        public static unsafe extern Int32 ReadArrayIntegers32(HandleProxy* proxy, Int32 start, Int32* buffer, Int32 count);
+        public delegate Int32 ReadArrayIntegers_ImportFuncType(HandleProxy* proxy, Int32 start, Int32* buffer, Int32 count);
+        public static ReadArrayIntegers_ImportFuncType ReadArrayIntegers = (Environment.Is64BitProcess ? (ReadArrayIntegers_ImportFuncType)ReadArrayIntegers64 : ReadArrayIntegers32);
+
+        [DllImport("V8_Net_Proxy_x86", EntryPoint = "GetArrayValues")]
+        public static unsafe extern HandleProxy* GetArrayValues32(HandleProxy* proxy, Int32 start, Int32 count, PrimitiveValue* values);
+        public delegate HandleProxy* GetArrayValues_ImportFuncType(HandleProxy* proxy, Int32 start, Int32 count, PrimitiveValue* values);
+        public static GetArrayValues_ImportFuncType GetArrayValues = (Environment.Is64BitProcess ? (GetArrayValues_ImportFuncType)GetArrayValues64 : GetArrayValues32);
+
         [DllImport("V8_Net_Proxy_x86", EntryPoint = "CreateFunctionTemplateProxy", CharSet = CharSet.Unicode)]
         public static unsafe extern NativeFunctionTemplateProxy* CreateFunctionTemplateProxy32(NativeV8EngineProxy* engine, string className, NativeFunctionCallback callback);
         public delegate NativeFunctionTemplateProxy* CreateFunctionTemplateProxy_ImportFuncType(NativeV8EngineProxy* engine, string className, NativeFunctionCallback callback);
@@ -267,6 +354,31 @@ namespace V8.Net
         public delegate HandleProxy* CreateInstanceFromFunctionTemplate_ImportFuncType(NativeFunctionTemplateProxy* functionTemplateProxy, Int32 objID, Int32 argCount = 0, HandleProxy** args = null);
         public static CreateInstanceFromFunctionTemplate_ImportFuncType CreateInstanceFromFunctionTemplate = (Environment.Is64BitProcess ? (CreateInstanceFromFunctionTemplate_ImportFuncType)CreateInstanceFromFunctionTemplate64 : CreateInstanceFromFunctionTemplate32);
 
+        [DllImport("V8_Net_Proxy_x86", EntryPoint = "SetFunctionTemplatePrimitiveCallback")]
+        public static unsafe extern void SetFunctionTemplatePrimitiveCallback32(NativeFunctionTemplateProxy* proxy, PrimitiveSignature signature, void* callback);
+        public delegate void SetFunctionTemplatePrimitiveCallback_ImportFuncType(NativeFunctionTemplateProxy* proxy, PrimitiveSignature signature, void* callback);
+        public static SetFunctionTemplatePrimitiveCallback_ImportFuncType SetFunctionTemplatePrimitiveCallback = (Environment.Is64BitProcess ? (SetFunctionTemplatePrimitiveCallback_ImportFuncType)SetFunctionTemplatePrimitiveCallback64 : SetFunctionTemplatePrimitiveCallback32);
+
+        [DllImport("V8_Net_Proxy_x86", EntryPoint = "SetFunctionTemplateArgsCallback")]
+        public static unsafe extern void SetFunctionTemplateArgsCallback32(NativeFunctionTemplateProxy* proxy, NativeFunctionArgsCallback callback);
+        public delegate void SetFunctionTemplateArgsCallback_ImportFuncType(NativeFunctionTemplateProxy* proxy, NativeFunctionArgsCallback callback);
+        public static SetFunctionTemplateArgsCallback_ImportFuncType SetFunctionTemplateArgsCallback = (Environment.Is64BitProcess ? (SetFunctionTemplateArgsCallback_ImportFuncType)SetFunctionTemplateArgsCallback64 : SetFunctionTemplateArgsCallback32);
+
+        [DllImport("V8_Net_Proxy_x86", EntryPoint = "GetCallbackThis")]
+        public static unsafe extern HandleProxy* GetCallbackThis32(NativeCallbackArguments* args);
+        public delegate HandleProxy* GetCallbackThis_ImportFuncType(NativeCallbackArguments* args);
+        public static GetCallbackThis_ImportFuncType GetCallbackThis = (Environment.Is64BitProcess ? (GetCallbackThis_ImportFuncType)GetCallbackThis64 : GetCallbackThis32);
+
+        [DllImport("V8_Net_Proxy_x86", EntryPoint = "GetCallbackArgument")]
+        public static unsafe extern HandleProxy* GetCallbackArgument32(NativeCallbackArguments* args, Int32 index);
+        public delegate HandleProxy* GetCallbackArgument_ImportFuncType(NativeCallbackArguments* args, Int32 index);
+        public static GetCallbackArgument_ImportFuncType GetCallbackArgument = (Environment.Is64BitProcess ? (GetCallbackArgument_ImportFuncType)GetCallbackArgument64 : GetCallbackArgument32);
+
+        [DllImport("V8_Net_Proxy_x86", EntryPoint = "GetCallbackArgumentValue")]
+        public static unsafe extern void GetCallbackArgumentValue32(NativeCallbackArguments* args, Int32 index, PrimitiveValue* value);
+        public delegate void GetCallbackArgumentValue_ImportFuncType(NativeCallbackArguments* args, Int32 index, PrimitiveValue* value);
+        public static GetCallbackArgumentValue_ImportFuncType GetCallbackArgumentValue = (Environment.Is64BitProcess ? (GetCallbackArgumentValue_ImportFuncType)GetCallbackArgumentValue64 : GetCallbackArgumentValue32);
+
         [DllImport("V8_Net_Proxy_x86", EntryPoint = "SetFunctionTemplateProperty", CharSet = CharSet.Unicode)]
         public static unsafe extern void SetFunctionTemplateProperty32(NativeFunctionTemplateProxy* proxy, string name, HandleProxy* value, V8PropertyAttributes attributes = V8PropertyAttributes.None);
         public delegate void SetFunctionTemplateProperty_ImportFuncType(NativeFunctionTemplateProxy* proxy, string name, HandleProxy* value, V8PropertyAttributes attributes = V8PropertyAttributes.None);
@@ -317,6 +429,21 @@ namespace V8.Net
         public delegate HandleProxy* CreateStringArray_ImportFuncType(NativeV8EngineProxy* engine, char** items, Int32 length = 0);
         public static CreateStringArray_ImportFuncType CreateStringArray = (Environment.Is64BitProcess ? (CreateStringArray_ImportFuncType)CreateStringArray64 : CreateStringArray32);
 
+        [DllImport("V8_Net_Proxy_x86", EntryPoint = "CreateArrayOfStrings")]
+        public static extern HandleProxy* CreateArrayOfStrings32(NativeV8EngineProxy* engine, char** strings, Int32* lengths, Int32 count);
+        public delegate HandleProxy* CreateArrayOfStrings_ImportFuncType(NativeV8EngineProxy* engine, char** strings, Int32* lengths, Int32 count);
+        public static CreateArrayOfStrings_ImportFuncType CreateArrayOfStrings = (Environment.Is64BitProcess ? (CreateArrayOfStrings_ImportFuncType)CreateArrayOfStrings64 : CreateArrayOfStrings32);
+
+        [DllImport("V8_Net_Proxy_x86", EntryPoint = "CreateArrayOfNumbers")]
+        public static extern HandleProxy* CreateArrayOfNumbers32(NativeV8EngineProxy* engine, double* values, Int32 length);
+        public delegate HandleProxy* CreateArrayOfNumbers_ImportFuncType(NativeV8EngineProxy* engine, double* values, Int32 length);
+        public static CreateArrayOfNumbers_ImportFuncType CreateArrayOfNumbers = (Environment.Is64BitProcess ? (CreateArrayOfNumbers_ImportFuncType)CreateArrayOfNumbers64 : CreateArrayOfNumbers32);
+
+        [DllImport("V8_Net_Proxy_x86", EntryPoint = "CreateArrayOfIntegers")]
+        public static extern HandleProxy* CreateArrayOfIntegers32(NativeV8EngineProxy* engine, Int32* values, Int32 length);
+        public delegate HandleProxy* CreateArrayOfIntegers_ImportFuncType(NativeV8EngineProxy* engine, Int32* values, Int32 length);
+        public static CreateArrayOfIntegers_ImportFuncType CreateArrayOfIntegers = (Environment.Is64BitProcess ? (CreateArrayOfIntegers_ImportFuncType)CreateArrayOfIntegers64 : CreateArrayOfIntegers32);
+
         [DllImport("V8_Net_Proxy_x86", EntryPoint = "CreateNullValue", CharSet = CharSet.Unicode)]
         public static extern HandleProxy* CreateNullValue32(NativeV8EngineProxy* engine);
         public delegate HandleProxy* CreateNullValue_ImportFuncType(NativeV8EngineProxy* engine);
@@ -342,11 +469,127 @@ namespace V8.Net
         public delegate void UpdateHandleValue_ImportFuncType(HandleProxy* handle);
         public static UpdateHandleValue_ImportFuncType UpdateHandleValue = (Environment.Is64BitProcess ? (UpdateHandleValue_ImportFuncType)UpdateHandleValue64 : UpdateHandleValue32);
 
+        [DllImport("V8_Net_Proxy_x86", EntryPoint = "UpdateHandleValueText")]
+        public static extern void UpdateHandleValueText32(HandleProxy* handle);
+        public delegate void UpdateHandleValueText_ImportFuncType(HandleProxy* handle);
+        public static UpdateHandleValueText_ImportFuncType UpdateHandleValueText = (Environment.Is64BitProcess ? (UpdateHandleValueText_ImportFuncType)UpdateHandleValueText64 : UpdateHandleValueText32);
+
         [DllImport("V8_Net_Proxy_x86", EntryPoint = "GetHandleManagedObjectID")]
         public static extern int GetHandleManagedObjectID32(HandleProxy* handle);
         public delegate int GetHandleManagedObjectID_ImportFuncType(HandleProxy* handle);
         public static GetHandleManagedObjectID_ImportFuncType GetHandleManagedObjectID = (Environment.Is64BitProcess ? (GetHandleManagedObjectID_ImportFuncType)GetHandleManagedObjectID64 : GetHandleManagedObjectID32);
 
+        [DllImport("V8_Net_Proxy_x86", EntryPoint = "GetStringLength")]
+        public static extern Int32 GetStringLength32(HandleProxy* handle);
+        public delegate Int32 GetStringLength_ImportFuncType(HandleProxy* handle);
+        public static GetStringLength_ImportFuncType GetStringLength = (Environment.Is64BitProcess ? (GetStringLength_ImportFuncType)GetStringLength64 : GetStringLength32);
+
+        [DllImport("V8_Net_Proxy_x86", EntryPoint = "ReadString")]
+        public static extern Int32 ReadString32(HandleProxy* handle, char* buffer, Int32 start, Int32 length);
+        public delegate Int32 ReadString_ImportFuncType(HandleProxy* handle, char* buffer, Int32 start, Int32 length);
+        public static ReadString_ImportFuncType ReadString = (Environment.Is64BitProcess ? (ReadString_ImportFuncType)ReadString64 : ReadString32);
+
+        [DllImport("V8_Net_Proxy_x86", EntryPoint = "GetErrorLocation")]
+        public static extern bool GetErrorLocation32(HandleProxy* handle, out Int32 line, out Int32 column);
+        public delegate bool GetErrorLocation_ImportFuncType(HandleProxy* handle, out Int32 line, out Int32 column);
+        public static GetErrorLocation_ImportFuncType GetErrorLocation = (Environment.Is64BitProcess ? (GetErrorLocation_ImportFuncType)GetErrorLocation64 : GetErrorLocation32);
+
+        [DllImport("V8_Net_Proxy_x86", EntryPoint = "GetErrorField")]
+        public static extern HandleProxy* GetErrorField32(HandleProxy* handle, ScriptErrorField field);
+        public delegate HandleProxy* GetErrorField_ImportFuncType(HandleProxy* handle, ScriptErrorField field);
+        public static GetErrorField_ImportFuncType GetErrorField = (Environment.Is64BitProcess ? (GetErrorField_ImportFuncType)GetErrorField64 : GetErrorField32);
+
+        [DllImport("V8_Net_Proxy_x86", EntryPoint = "RegisterShape")]
+        public static extern Int32 RegisterShape32(NativeV8EngineProxy* engine, char** names, ShapeFieldType* types, Int32 count);
+        public delegate Int32 RegisterShape_ImportFuncType(NativeV8EngineProxy* engine, char** names, ShapeFieldType* types, Int32 count);
+        public static RegisterShape_ImportFuncType RegisterShape = (Environment.Is64BitProcess ? (RegisterShape_ImportFuncType)RegisterShape64 : RegisterShape32);
+
+        [DllImport("V8_Net_Proxy_x86", EntryPoint = "ExtractShape")]
+        public static extern HandleProxy* ExtractShape32(HandleProxy* handle, Int32 shapeID, byte* buffer, Int32 bufferSize, Int32* mismatches);
+        public delegate HandleProxy* ExtractShape_ImportFuncType(HandleProxy* handle, Int32 shapeID, byte* buffer, Int32 bufferSize, Int32* mismatches);
+        public static ExtractShape_ImportFuncType ExtractShape = (Environment.Is64BitProcess ? (ExtractShape_ImportFuncType)ExtractShape64 : ExtractShape32);
+
+        [DllImport("V8_Net_Proxy_x86", EntryPoint = "CreateFromShape")]
+        public static extern HandleProxy* CreateFromShape32(NativeV8EngineProxy* engine, Int32 shapeID, byte* buffer);
+        public delegate HandleProxy* CreateFromShape_ImportFuncType(NativeV8EngineProxy* engine, Int32 shapeID, byte* buffer);
+        public static CreateFromShape_ImportFuncType CreateFromShape = (Environment.Is64BitProcess ? (CreateFromShape_ImportFuncType)CreateFromShape64 : CreateFromShape32);
+
+        [DllImport("V8_Net_Proxy_x86", EntryPoint = "FreeShapeValues")]
+        public static extern void FreeShapeValues32(NativeV8EngineProxy* engine, Int32 shapeID, byte* buffer);
+        public delegate void FreeShapeValues_ImportFuncType(NativeV8EngineProxy* engine, Int32 shapeID, byte* buffer);
+        public static FreeShapeValues_ImportFuncType FreeShapeValues = (Environment.Is64BitProcess ? (FreeShapeValues_ImportFuncType)FreeShapeValues64 : FreeShapeValues32);
+
+        [DllImport("V8_Net_Proxy_x86", EntryPoint = "CreateDataset")]
+        public static extern HandleProxy* CreateDataset32(NativeV8EngineProxy* engine, Int32 rowCount, DatasetColumnInfo* columns, Int32 columnCount, NativeReleaseCallback releaseCallback, Int32 releaseID);
+        public delegate HandleProxy* CreateDataset_ImportFuncType(NativeV8EngineProxy* engine, Int32 rowCount, DatasetColumnInfo* columns, Int32 columnCount, NativeReleaseCallback releaseCallback, Int32 releaseID);
+        public static CreateDataset_ImportFuncType CreateDataset = (Environment.Is64BitProcess ? (CreateDataset_ImportFuncType)CreateDataset64 : CreateDataset32);
+
+        [DllImport("V8_Net_Proxy_x86", EntryPoint = "CreateExternalArrayBuffer")]
+        public static extern HandleProxy* CreateExternalArrayBuffer32(NativeV8EngineProxy* engine, void* data, Int64 length, NativeReleaseCallback releaseCallback, Int32 releaseID);
+        public delegate HandleProxy* CreateExternalArrayBuffer_ImportFuncType(NativeV8EngineProxy* engine, void* data, Int64 length, NativeReleaseCallback releaseCallback, Int32 releaseID);
+        public static CreateExternalArrayBuffer_ImportFuncType CreateExternalArrayBuffer = (Environment.Is64BitProcess ? (CreateExternalArrayBuffer_ImportFuncType)CreateExternalArrayBuffer64 : CreateExternalArrayBuffer32);
+
+        [DllImport("V8_Net_Proxy_x86", EntryPoint = "CreateTypedArray")]
+        public static extern HandleProxy* CreateTypedArray32(HandleProxy* buffer, TypedArrayType type, Int64 byteOffset, Int64 length);
+        public delegate HandleProxy* CreateTypedArray_ImportFuncType(HandleProxy* buffer, TypedArrayType type, Int64 byteOffset, Int64 length);
+        public static CreateTypedArray_ImportFuncType CreateTypedArray = (Environment.Is64BitProcess ? (CreateTypedArray_ImportFuncType)CreateTypedArray64 : CreateTypedArray32);
+
+        [DllImport("V8_Net_Proxy_x86", EntryPoint = "GetArrayBufferContents")]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern bool GetArrayBufferContents32(HandleProxy* handle, void** data, Int64* length);
+        public delegate bool GetArrayBufferContents_ImportFuncType(HandleProxy* handle, void** data, Int64* length);
+        public static GetArrayBufferContents_ImportFuncType GetArrayBufferContents = (Environment.Is64BitProcess ? (GetArrayBufferContents_ImportFuncType)GetArrayBufferContents64 : GetArrayBufferContents32);
+
+        [DllImport("V8_Net_Proxy_x86", EntryPoint = "SetArrayBufferLimits")]
+        public static extern void SetArrayBufferLimits32(NativeV8EngineProxy* engine, Int64 maxBytes, Int64 maxPooledBytes);
+        public delegate void SetArrayBufferLimits_ImportFuncType(NativeV8EngineProxy* engine, Int64 maxBytes, Int64 maxPooledBytes);
+        public static SetArrayBufferLimits_ImportFuncType SetArrayBufferLimits = (Environment.Is64BitProcess ? (SetArrayBufferLimits_ImportFuncType)SetArrayBufferLimits64 : SetArrayBufferLimits32);
+
+        [DllImport("V8_Net_Proxy_x86", EntryPoint = "GetArrayBufferAllocatorStats")]
+        public static extern void GetArrayBufferAllocatorStats32(NativeV8EngineProxy* engine, ArrayBufferAllocatorStats* stats);
+        public delegate void GetArrayBufferAllocatorStats_ImportFuncType(NativeV8EngineProxy* engine, ArrayBufferAllocatorStats* stats);
+        public static GetArrayBufferAllocatorStats_ImportFuncType GetArrayBufferAllocatorStats = (Environment.Is64BitProcess ? (GetArrayBufferAllocatorStats_ImportFuncType)GetArrayBufferAllocatorStats64 : GetArrayBufferAllocatorStats32);
+
+        [DllImport("V8_Net_Proxy_x86", EntryPoint = "ParseJSON")]
+        public static extern HandleProxy* ParseJSON32(NativeV8EngineProxy* engine, char* json, Int32 length);
+        public delegate HandleProxy* ParseJSON_ImportFuncType(NativeV8EngineProxy* engine, char* json, Int32 length);
+        public static ParseJSON_ImportFuncType ParseJSON = (Environment.Is64BitProcess ? (ParseJSON_ImportFuncType)ParseJSON64 : ParseJSON32);
+
+        [DllImport("V8_Net_Proxy_x86", EntryPoint = "ParseJSONUtf8")]
+        public static extern HandleProxy* ParseJSONUtf832(NativeV8EngineProxy* engine, byte* json, Int32 length);
+        public delegate HandleProxy* ParseJSONUtf8_ImportFuncType(NativeV8EngineProxy* engine, byte* json, Int32 length);
+        public static ParseJSONUtf8_ImportFuncType ParseJSONUtf8 = (Environment.Is64BitProcess ? (ParseJSONUtf8_ImportFuncType)ParseJSONUtf864 : ParseJSONUtf832);
+
+        [DllImport("V8_Net_Proxy_x86", EntryPoint = "StringifyJSON", CharSet = CharSet.Unicode)]
+        public static extern HandleProxy* StringifyJSON32(HandleProxy* handle, string gap, bool utf8, void* buffer, Int32 capacity, Int32* length, NativeWriteCallback callback);
+        public delegate HandleProxy* StringifyJSON_ImportFuncType(HandleProxy* handle, string gap, bool utf8, void* buffer, Int32 capacity, Int32* length, NativeWriteCallback callback);
+        public static StringifyJSON_ImportFuncType StringifyJSON = (Environment.Is64BitProcess ? (StringifyJSON_ImportFuncType)StringifyJSON64 : StringifyJSON32);
+
+        [DllImport("V8_Net_Proxy_x86", EntryPoint = "SerializeValue")]
+        public static extern Int32 SerializeValue32(HandleProxy* handle, byte** buffer, Int32* capacity, Int32 maxDepth, Int32 maxSize);
+        public delegate Int32 SerializeValue_ImportFuncType(HandleProxy* handle, byte** buffer, Int32* capacity, Int32 maxDepth, Int32 maxSize);
+        public static SerializeValue_ImportFuncType SerializeValue = (Environment.Is64BitProcess ? (SerializeValue_ImportFuncType)SerializeValue64 : SerializeValue32);
+
+        [DllImport("V8_Net_Proxy_x86", EntryPoint = "DeserializeValue")]
+        public static extern HandleProxy* DeserializeValue32(NativeV8EngineProxy* engine, byte* data, Int32 length, Int32 maxDepth);
+        public delegate HandleProxy* DeserializeValue_ImportFuncType(NativeV8EngineProxy* engine, byte* data, Int32 length, Int32 maxDepth);
+        public static DeserializeValue_ImportFuncType DeserializeValue = (Environment.Is64BitProcess ? (DeserializeValue_ImportFuncType)DeserializeValue64 : DeserializeValue32);
+
+        [DllImport("V8_Net_Proxy_x86", EntryPoint = "FreeNativeMemory")]
+        public static extern void FreeNativeMemory32(void* ptr);
+        public delegate void FreeNativeMemory_ImportFuncType(void* ptr);
+        public static FreeNativeMemory_ImportFuncType FreeNativeMemory = (Environment.Is64BitProcess ? (FreeNativeMemory_ImportFuncType)FreeNativeMemory64 : FreeNativeMemory32);
+
+        [DllImport("V8_Net_Proxy_x86", EntryPoint = "RegisterCommandName", CharSet = CharSet.Unicode)]
+        public static extern Int32 RegisterCommandName32(NativeV8EngineProxy* engine, string name);
+        public delegate Int32 RegisterCommandName_ImportFuncType(NativeV8EngineProxy* engine, string name);
+        public static RegisterCommandName_ImportFuncType RegisterCommandName = (Environment.Is64BitProcess ? (RegisterCommandName_ImportFuncType)RegisterCommandName64 : RegisterCommandName32);
+
+        [DllImport("V8_Net_Proxy_x86", EntryPoint = "ExecuteCommandBuffer")]
+        public static extern HandleProxy* ExecuteCommandBuffer32(NativeV8EngineProxy* engine, byte* commands, Int32 length, PrimitiveValue* results, Int32 resultCapacity, Int32* resultCount);
+        public delegate HandleProxy* ExecuteCommandBuffer_ImportFuncType(NativeV8EngineProxy* engine, byte* commands, Int32 length, PrimitiveValue* results, Int32 resultCapacity, Int32* resultCount);
+        public static ExecuteCommandBuffer_ImportFuncType ExecuteCommandBuffer = (Environment.Is64BitProcess ? (ExecuteCommandBuffer_ImportFuncType)ExecuteCommandBuffer64 : ExecuteCommandBuffer32);
+
         [DllImport("V8_Net_Proxy_x86", EntryPoint = "CreateHandleProxyTest")]
         public static extern HandleProxy* CreateHandleProxyTest32();
         public delegate HandleProxy* CreateHandleProxyTest_ImportFuncType();
@@ -41,12 +41,28 @@ namespace V8.Net
 
         // --------------------------------------------------------------------------------------------------------------------
 
+        [DllImport("V8_Net_Proxy_x64", EntryPoint = "ConfigurePlatform")]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern bool ConfigurePlatform64(PlatformOptions* options);
+
+        [DllImport("V8_Net_Proxy_x64", EntryPoint = "GetPlatformStats")]
+        public static extern void GetPlatformStats64(PlatformStats* stats);
+
         [DllImport("V8_Net_Proxy_x64", EntryPoint = "CreateV8EngineProxy")]
         public extern static NativeV8EngineProxy* CreateV8EngineProxy64(bool enableDebugging, void* debugMessageDispatcher, int debugPort);
 
+        [DllImport("V8_Net_Proxy_x64", EntryPoint = "CreateV8EngineProxyEx")]
+        public extern static NativeV8EngineProxy* CreateV8EngineProxyEx64(bool enableDebugging, void* debugMessageDispatcher, int debugPort, V8EngineFlags flags);
+
         [DllImport("V8_Net_Proxy_x64", EntryPoint = "DestroyV8EngineProxy", ExactSpelling = false)]
         public static extern void DestroyV8EngineProxy64(NativeV8EngineProxy* engine);
 
+        [DllImport("V8_Net_Proxy_x64", EntryPoint = "BeginSession")]
+        public static extern Int32 BeginSession64(NativeV8EngineProxy* engine);
+
+        [DllImport("V8_Net_Proxy_x64", EntryPoint = "EndSession")]
+        public static extern Int32 EndSession64(NativeV8EngineProxy* engine);
+
         [DllImport("V8_Net_Proxy_x64", EntryPoint = "CreateContext")]
         public extern static NativeContext* CreateContext64(NativeV8EngineProxy* engine, NativeObjectTemplateProxy* templatePoxy);
 
@@ -85,6 +101,9 @@ namespace V8.Net
         [DllImport("V8_Net_Proxy_x64", EntryPoint = "TerminateExecution")]
         public static extern void TerminateExecution64(NativeV8EngineProxy* engine);
 
+        [DllImport("V8_Net_Proxy_x64", EntryPoint = "GetArgumentBufferStats")]
+        public static extern void GetArgumentBufferStats64(NativeV8EngineProxy* engine, out ArgumentBufferStats stats);
+
         //  .  .  .  .  .  .  .  .  .  .  .  .  .  .  .  .  .  .  .  .  .  .  .  .  .  .  .  .  .  .  .  .  .  .  .  .  .  .  . 
 
         [DllImport("V8_Net_Proxy_x64", EntryPoint = "CreateObjectTemplateProxy")]
@@ -139,6 +158,10 @@ namespace V8.Net
         public static unsafe extern void ConnectObject64(HandleProxy* handleProxy, Int32 objID, void* templateProxy = null);
 
 
+        [DllImport("V8_Net_Proxy_x64", EntryPoint = "SetObjectCLRTypeID")]
+        public static unsafe extern bool SetObjectCLRTypeID64(HandleProxy* handleProxy, Int32 typeID);
+
+
         [DllImport("V8_Net_Proxy_x64", EntryPoint = "GetObjectPrototype")]
         public static unsafe extern HandleProxy* GetObjectPrototype64(HandleProxy* handleProxy);
 
@@ -158,6 +181,18 @@ namespace V8.Net
         public static unsafe extern bool SetObjectPropertyByName64(HandleProxy* proxy, string name, HandleProxy* value, V8PropertyAttributes attributes = V8PropertyAttributes.None);
 
 
+        [DllImport("V8_Net_Proxy_x64", EntryPoint = "GetObjectProperties", CharSet = CharSet.Unicode)]
+        public static unsafe extern HandleProxy* GetObjectProperties64(HandleProxy* proxy, [MarshalAs(UnmanagedType.LPArray, ArraySubType = UnmanagedType.LPWStr)] string[] names, Int32 count, PrimitiveValue* values);
+        // Return: null on success, or an error handle (strings in 'values' must be freed using 'FreePrimitiveValues()')
+
+        [DllImport("V8_Net_Proxy_x64", EntryPoint = "SetObjectProperties", CharSet = CharSet.Unicode)]
+        public static unsafe extern HandleProxy* SetObjectProperties64(HandleProxy* proxy, [MarshalAs(UnmanagedType.LPArray, ArraySubType = UnmanagedType.LPWStr)] string[] names, PrimitiveValue* values, Int32 count, V8PropertyAttributes attributes = V8PropertyAttributes.None);
+        // Return: null on success, or an error handle
+
+        [DllImport("V8_Net_Proxy_x64", EntryPoint = "FreePrimitiveValues")]
+        public static unsafe extern void FreePrimitiveValues64(PrimitiveValue* values, Int32 count);
+
+
         [DllImport("V8_Net_Proxy_x64", EntryPoint = "SetObjectPropertyByIndex")]
         public static unsafe extern bool SetObjectPropertyByIndex64(HandleProxy* proxy, Int32 index, HandleProxy* value, V8PropertyAttributes attributes = V8PropertyAttributes.None);
 
@@ -192,6 +227,19 @@ namespace V8.Net
             NativeGetterAccessor getter, NativeSetterAccessor setter,
             V8AccessControl access, V8PropertyAttributes attributes);
 
+        [DllImport("V8_Net_Proxy_x64", EntryPoint = "SetObjectTemplateDirectAccessor", CharSet = CharSet.Unicode)]
+        public static unsafe extern void SetObjectTemplateDirectAccessor64(NativeObjectTemplateProxy* proxy, string name, Int32 offset, DirectAccessorType type, V8PropertyAttributes attributes);
+
+        [DllImport("V8_Net_Proxy_x64", EntryPoint = "SetObjectDataPointer")]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static unsafe extern bool SetObjectDataPointer64(HandleProxy* proxy, void* data);
+
+        [DllImport("V8_Net_Proxy_x64", EntryPoint = "InvalidatePropertyCache", CharSet = CharSet.Unicode)]
+        public static unsafe extern void InvalidatePropertyCache64(HandleProxy* proxy, string name);
+
+        [DllImport("V8_Net_Proxy_x64", EntryPoint = "InvalidateAllPropertyCaches")]
+        public static unsafe extern void InvalidateAllPropertyCaches64(NativeV8EngineProxy* engine);
+
         [DllImport("V8_Net_Proxy_x64", EntryPoint = "SetObjectTemplateProperty", CharSet = CharSet.Unicode)]
         public static unsafe extern void SetObjectTemplateProperty64(NativeObjectTemplateProxy* proxy, string name, HandleProxy* value, V8PropertyAttributes attributes = V8PropertyAttributes.None);
 
@@ -213,6 +261,18 @@ namespace V8.Net
         [DllImport("V8_Net_Proxy_x64", EntryPoint = "GetArrayLength")]
         public static unsafe extern Int32 GetArrayLength64(HandleProxy* proxy);
 
+        [DllImport("V8_Net_Proxy_x64", EntryPoint = "ReadArrayNumbers")]
+        public static unsafe extern Int32 ReadArrayNumbers64(HandleProxy* proxy, Int32 start, double* buffer, Int32 count);
+        // Return: the number of elements read, or -1 if the handle is not an array or typed array
+
+        [DllImport("V8_Net_Proxy_x64", EntryPoint = "ReadArrayIntegers")]
+        public static unsafe extern Int32 ReadArrayIntegers64(HandleProxy* proxy, Int32 start, Int32* buffer, Int32 count);
+        // Return: the number of elements read, or -1 if the handle is not an array or typed array
+
+        [DllImport("V8_Net_Proxy_x64", EntryPoint = "GetArrayValues")]
+        public static unsafe extern HandleProxy* GetArrayValues64(HandleProxy* proxy, Int32 start, Int32 count, PrimitiveValue* values);
+        // Return: null on success, or an error handle (strings in 'values' must be freed using 'FreePrimitiveValues()')
+
 
         //  .  .  .  .  .  .  .  .  .  .  .  .  .  .  .  .  .  .  .  .  .  .  .  .  .  .  .  .  .  .  .  .  .  .  .  .  .  .  . 
 
@@ -245,6 +305,21 @@ namespace V8.Net
 
         // Return: HandleProxy*
 
+        [DllImport("V8_Net_Proxy_x64", EntryPoint = "SetFunctionTemplatePrimitiveCallback")]
+        public static unsafe extern void SetFunctionTemplatePrimitiveCallback64(NativeFunctionTemplateProxy* proxy, PrimitiveSignature signature, void* callback);
+
+        [DllImport("V8_Net_Proxy_x64", EntryPoint = "SetFunctionTemplateArgsCallback")]
+        public static unsafe extern void SetFunctionTemplateArgsCallback64(NativeFunctionTemplateProxy* proxy, NativeFunctionArgsCallback callback);
+
+        [DllImport("V8_Net_Proxy_x64", EntryPoint = "GetCallbackThis")]
+        public static unsafe extern HandleProxy* GetCallbackThis64(NativeCallbackArguments* args);
+
+        [DllImport("V8_Net_Proxy_x64", EntryPoint = "GetCallbackArgument")]
+        public static unsafe extern HandleProxy* GetCallbackArgument64(NativeCallbackArguments* args, Int32 index);
+
+        [DllImport("V8_Net_Proxy_x64", EntryPoint = "GetCallbackArgumentValue")]
+        public static unsafe extern void GetCallbackArgumentValue64(NativeCallbackArguments* args, Int32 index, PrimitiveValue* value);
+
         [DllImport("V8_Net_Proxy_x64", EntryPoint = "SetFunctionTemplateProperty", CharSet = CharSet.Unicode)]
         public static unsafe extern void SetFunctionTemplateProperty64(NativeFunctionTemplateProxy* proxy, string name, HandleProxy* value, V8PropertyAttributes attributes = V8PropertyAttributes.None);
 
@@ -294,6 +369,16 @@ namespace V8.Net
         public static extern HandleProxy* CreateStringArray64(NativeV8EngineProxy* engine, char** items, Int32 length = 0);
 
 
+        [DllImport("V8_Net_Proxy_x64", EntryPoint = "CreateArrayOfStrings")]
+        public static extern HandleProxy* CreateArrayOfStrings64(NativeV8EngineProxy* engine, char** strings, Int32* lengths, Int32 count);
+
+        [DllImport("V8_Net_Proxy_x64", EntryPoint = "CreateArrayOfNumbers")]
+        public static extern HandleProxy* CreateArrayOfNumbers64(NativeV8EngineProxy* engine, double* values, Int32 length);
+
+        [DllImport("V8_Net_Proxy_x64", EntryPoint = "CreateArrayOfIntegers")]
+        public static extern HandleProxy* CreateArrayOfIntegers64(NativeV8EngineProxy* engine, Int32* values, Int32 length);
+
+
         [DllImport("V8_Net_Proxy_x64", EntryPoint = "CreateNullValue", CharSet = CharSet.Unicode)]
         public static extern HandleProxy* CreateNullValue64(NativeV8EngineProxy* engine);
 
@@ -316,11 +401,114 @@ namespace V8.Net
         [DllImport("V8_Net_Proxy_x64", EntryPoint = "UpdateHandleValue")]
         public static extern void UpdateHandleValue64(HandleProxy* handle);
 
+        [DllImport("V8_Net_Proxy_x64", EntryPoint = "UpdateHandleValueText")]
+        public static extern void UpdateHandleValueText64(HandleProxy* handle);
+
 
         [DllImport("V8_Net_Proxy_x64", EntryPoint = "GetHandleManagedObjectID")]
         public static extern int GetHandleManagedObjectID64(HandleProxy* handle);
 
 
+        [DllImport("V8_Net_Proxy_x64", EntryPoint = "GetStringLength")]
+        public static extern Int32 GetStringLength64(HandleProxy* handle);
+
+        // (returns the number of characters copied; no null terminator is written)
+
+        [DllImport("V8_Net_Proxy_x64", EntryPoint = "ReadString")]
+        public static extern Int32 ReadString64(HandleProxy* handle, char* buffer, Int32 start, Int32 length);
+
+
+        [DllImport("V8_Net_Proxy_x64", EntryPoint = "GetErrorLocation")]
+        public static extern bool GetErrorLocation64(HandleProxy* handle, out Int32 line, out Int32 column);
+
+
+        [DllImport("V8_Net_Proxy_x64", EntryPoint = "GetErrorField")]
+        public static extern HandleProxy* GetErrorField64(HandleProxy* handle, ScriptErrorField field);
+
+
+        // --------------------------------------------------------------------------------------------------------------------
+        // Object Shapes
+
+        [DllImport("V8_Net_Proxy_x64", EntryPoint = "RegisterShape")]
+        public static extern Int32 RegisterShape64(NativeV8EngineProxy* engine, char** names, ShapeFieldType* types, Int32 count);
+
+        [DllImport("V8_Net_Proxy_x64", EntryPoint = "ExtractShape")]
+        public static extern HandleProxy* ExtractShape64(HandleProxy* handle, Int32 shapeID, byte* buffer, Int32 bufferSize, Int32* mismatches);
+
+        [DllImport("V8_Net_Proxy_x64", EntryPoint = "CreateFromShape")]
+        public static extern HandleProxy* CreateFromShape64(NativeV8EngineProxy* engine, Int32 shapeID, byte* buffer);
+
+        [DllImport("V8_Net_Proxy_x64", EntryPoint = "FreeShapeValues")]
+        public static extern void FreeShapeValues64(NativeV8EngineProxy* engine, Int32 shapeID, byte* buffer);
+
+
+        // --------------------------------------------------------------------------------------------------------------------
+        // Datasets
+
+        [DllImport("V8_Net_Proxy_x64", EntryPoint = "CreateDataset")]
+        public static extern HandleProxy* CreateDataset64(NativeV8EngineProxy* engine, Int32 rowCount, DatasetColumnInfo* columns, Int32 columnCount, NativeReleaseCallback releaseCallback, Int32 releaseID);
+
+
+        // --------------------------------------------------------------------------------------------------------------------
+        // Array Buffers
+
+        [DllImport("V8_Net_Proxy_x64", EntryPoint = "CreateExternalArrayBuffer")]
+        public static extern HandleProxy* CreateExternalArrayBuffer64(NativeV8EngineProxy* engine, void* data, Int64 length, NativeReleaseCallback releaseCallback, Int32 releaseID);
+
+        [DllImport("V8_Net_Proxy_x64", EntryPoint = "CreateTypedArray")]
+        public static extern HandleProxy* CreateTypedArray64(HandleProxy* buffer, TypedArrayType type, Int64 byteOffset, Int64 length);
+
+        [DllImport("V8_Net_Proxy_x64", EntryPoint = "GetArrayBufferContents")]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern bool GetArrayBufferContents64(HandleProxy* handle, void** data, Int64* length);
+
+        [DllImport("V8_Net_Proxy_x64", EntryPoint = "SetArrayBufferLimits")]
+        public static extern void SetArrayBufferLimits64(NativeV8EngineProxy* engine, Int64 maxBytes, Int64 maxPooledBytes);
+
+        [DllImport("V8_Net_Proxy_x64", EntryPoint = "GetArrayBufferAllocatorStats")]
+        public static extern void GetArrayBufferAllocatorStats64(NativeV8EngineProxy* engine, ArrayBufferAllocatorStats* stats);
+
+
+        // --------------------------------------------------------------------------------------------------------------------
+        // JSON
+
+        [DllImport("V8_Net_Proxy_x64", EntryPoint = "ParseJSON")]
+        public static extern HandleProxy* ParseJSON64(NativeV8EngineProxy* engine, char* json, Int32 length);
+
+        [DllImport("V8_Net_Proxy_x64", EntryPoint = "ParseJSONUtf8")]
+        public static extern HandleProxy* ParseJSONUtf864(NativeV8EngineProxy* engine, byte* json, Int32 length);
+
+        [DllImport("V8_Net_Proxy_x64", EntryPoint = "StringifyJSON", CharSet = CharSet.Unicode)]
+        public static extern HandleProxy* StringifyJSON64(HandleProxy* handle, string gap, bool utf8, void* buffer, Int32 capacity, Int32* length, NativeWriteCallback callback);
+        // Return: null on success, or an error handle
+
+
+        // --------------------------------------------------------------------------------------------------------------------
+        // Serialization
+
+        [DllImport("V8_Net_Proxy_x64", EntryPoint = "SerializeValue")]
+        public static extern Int32 SerializeValue64(HandleProxy* handle, byte** buffer, Int32* capacity, Int32 maxDepth, Int32 maxSize);
+        // Return: the number of bytes written, or a 'SerializerResult' error value (if '*buffer' changes, it must be freed using 'FreeNativeMemory()')
+
+        [DllImport("V8_Net_Proxy_x64", EntryPoint = "DeserializeValue")]
+        public static extern HandleProxy* DeserializeValue64(NativeV8EngineProxy* engine, byte* data, Int32 length, Int32 maxDepth);
+        // Return: the new value, or an error handle if the data is not valid
+
+        [DllImport("V8_Net_Proxy_x64", EntryPoint = "FreeNativeMemory")]
+        public static extern void FreeNativeMemory64(void* ptr);
+
+
+        // --------------------------------------------------------------------------------------------------------------------
+        // Command Buffers
+
+        [DllImport("V8_Net_Proxy_x64", EntryPoint = "RegisterCommandName", CharSet = CharSet.Unicode)]
+        public static extern Int32 RegisterCommandName64(NativeV8EngineProxy* engine, string name);
+
+        [DllImport("V8_Net_Proxy_x64", EntryPoint = "ExecuteCommandBuffer")]
+        public static extern HandleProxy* ExecuteCommandBuffer64(NativeV8EngineProxy* engine, byte* commands, Int32 length, PrimitiveValue* results, Int32 resultCapacity, Int32* resultCount);
+        // Return: null on success, or an error handle (strings in 'results' must be freed using 'FreePrimitiveValues()')
+
+
         // --------------------------------------------------------------------------------------------------------------------
         // Tests
 
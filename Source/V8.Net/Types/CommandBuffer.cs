@@ -0,0 +1,217 @@
+﻿using System;
+using System.Text;
+
+namespace V8.Net
+{
+    // ========================================================================================================================
+
+    /// <summary>
+    /// Records a sequence of operations (creating values, getting and setting properties, calling functions, etc.) that are
+    /// then run on the native side in a single call, under a single set of scopes.  This avoids the cost of crossing into the
+    /// native side for each step when building or reading many values at once.
+    /// <para>The commands work on a value stack (see 'CommandOpCode').  Property names are referenced by the IDs returned from
+    /// 'V8Engine.RegisterCommandName()', so they are only converted to JavaScript strings once.  Each 'Read()' pops a value and
+    /// adds it to the results returned from 'Execute()': primitive values are returned as CLR values (undefined and null both
+    /// return null, and dates return 'DateTime' values), and any other value is returned as an 'InternalHandle', which the
+    /// caller is responsible for disposing.</para>
+    /// <para>A buffer can be executed any number of times, and on any engine the property name IDs were registered with.</para>
+    /// </summary>
+    public unsafe sealed class CommandBuffer
+    {
+        // --------------------------------------------------------------------------------------------------------------------
+
+        byte[] _Data;
+        Int32 _Length;
+
+        /// <summary> The number of bytes of commands written so far. </summary>
+        public Int32 Length { get { return _Length; } }
+
+        /// <summary> The number of values that 'Execute()' will return (one per 'Read()'). </summary>
+        public Int32 ReadCount { get; private set; }
+
+        // --------------------------------------------------------------------------------------------------------------------
+
+        public CommandBuffer(Int32 capacity = 256)
+        {
+            _Data = new byte[capacity > 16 ? capacity : 16];
+        }
+
+        /// <summary>
+        /// Removes all the commands so the buffer can be reused.
+        /// </summary>
+        public CommandBuffer Clear()
+        {
+            _Length = 0;
+            ReadCount = 0;
+            return this;
+        }
+
+        // --------------------------------------------------------------------------------------------------------------------
+
+        void _Reserve(Int32 size)
+        {
+            if (_Length + size <= _Data.Length) return;
+            var newSize = _Data.Length * 2;
+            while (newSize < _Length + size)
+                newSize *= 2;
+            Array.Resize(ref _Data, newSize);
+        }
+
+        CommandBuffer _Write(CommandOpCode op)
+        {
+            _Reserve(1);
+            _Data[_Length++] = (byte)op;
+            return this;
+        }
+
+        CommandBuffer _Write(CommandOpCode op, Int32 operand)
+        {
+            _Write(op);
+            return _WriteInt32(operand);
+        }
+
+        CommandBuffer _WriteInt32(Int32 value)
+        {
+            _Reserve(sizeof(Int32));
+            fixed (byte* p = &_Data[_Length]) *(Int32*)p = value;
+            _Length += sizeof(Int32);
+            return this;
+        }
+
+        // --------------------------------------------------------------------------------------------------------------------
+
+        public CommandBuffer PushUndefined() { return _Write(CommandOpCode.PushUndefined); }
+
+        public CommandBuffer PushNull() { return _Write(CommandOpCode.PushNull); }
+
+        public CommandBuffer Push(bool value)
+        {
+            _Reserve(2);
+            _Data[_Length++] = (byte)CommandOpCode.PushBool;
+            _Data[_Length++] = value ? (byte)1 : (byte)0;
+            return this;
+        }
+
+        public CommandBuffer Push(Int32 value) { return _Write(CommandOpCode.PushInt32, value); }
+
+        public CommandBuffer Push(double value)
+        {
+            _Reserve(1 + sizeof(double));
+            _Data[_Length++] = (byte)CommandOpCode.PushNumber;
+            fixed (byte* p = &_Data[_Length]) *(double*)p = value;
+            _Length += sizeof(double);
+            return this;
+        }
+
+        /// <summary>
+        /// Pushes a string value (a null string pushes 'null').
+        /// </summary>
+        public CommandBuffer Push(string value)
+        {
+            if (value == null) return PushNull();
+
+            var byteCount = value.Length * sizeof(char);
+            _Write(CommandOpCode.PushString, value.Length);
+            _Reserve(byteCount);
+            _Length += Encoding.Unicode.GetBytes(value, 0, value.Length, _Data, _Length);
+            return this;
+        }
+
+        /// <summary>
+        /// Pushes the value of an existing handle (an empty handle pushes 'undefined').
+        /// Note: Only the handle's engine, ID, and generation are recorded, so the handle must not be disposed before the commands are
+        /// executed, and the buffer can then only be executed on that engine.  Executing fails if the handle was disposed, even if its
+        /// ID was since reused for another value.
+        /// </summary>
+        public CommandBuffer Push(InternalHandle handle)
+        {
+            var handleProxy = (HandleProxy*)handle;
+            _Write(CommandOpCode.PushHandle, handleProxy != null ? handleProxy->EngineID : -1);
+            _WriteInt32(handleProxy != null ? handleProxy->ID : -1);
+            return _WriteInt32(handleProxy != null ? handleProxy->Generation : 0);
+        }
+
+        public CommandBuffer PushGlobal() { return _Write(CommandOpCode.PushGlobal); }
+
+        public CommandBuffer CreateObject() { return _Write(CommandOpCode.CreateObject); }
+
+        public CommandBuffer CreateArray(Int32 length = 0) { return _Write(CommandOpCode.CreateArray, length); }
+
+        public CommandBuffer Dup() { return _Write(CommandOpCode.Dup); }
+
+        public CommandBuffer Pop() { return _Write(CommandOpCode.Pop); }
+
+        /// <summary> Replaces the object on the top of the stack with the value of one of its properties. </summary>
+        public CommandBuffer GetProperty(Int32 nameID) { return _Write(CommandOpCode.GetProperty, nameID); }
+
+        /// <summary> Pops a value and sets it as a property of the object under it (the object is left on the stack). </summary>
+        public CommandBuffer SetProperty(Int32 nameID) { return _Write(CommandOpCode.SetProperty, nameID); }
+
+        /// <summary> Replaces the object on the top of the stack with the value at the given index. </summary>
+        public CommandBuffer GetIndex(Int32 index) { return _Write(CommandOpCode.GetIndex, index); }
+
+        /// <summary> Pops a value and sets it at the given index of the object under it (the object is left on the stack). </summary>
+        public CommandBuffer SetIndex(Int32 index) { return _Write(CommandOpCode.SetIndex, index); }
+
+        /// <summary> Calls a function with the arguments on the top of the stack (pushed after the function and 'this'). </summary>
+        public CommandBuffer Call(Int32 argCount) { return _Write(CommandOpCode.Call, argCount); }
+
+        /// <summary> Calls a function property of an object with the arguments on the top of the stack (pushed after the object). </summary>
+        public CommandBuffer CallMethod(Int32 nameID, Int32 argCount)
+        {
+            return _Write(CommandOpCode.CallMethod, nameID)._WriteInt32(argCount);
+        }
+
+        /// <summary> Pops a value and adds it to the results returned from 'Execute()'. </summary>
+        public CommandBuffer Read()
+        {
+            ReadCount++;
+            return _Write(CommandOpCode.Read);
+        }
+
+        // --------------------------------------------------------------------------------------------------------------------
+
+        /// <summary>
+        /// Runs the commands on the given engine in a single native call and returns the values read (one per 'Read()').
+        /// If a command fails or a script error occurs, the remaining commands are skipped, the values read so far are released,
+        /// and the error is thrown.
+        /// </summary>
+        public object[] Execute(V8Engine engine)
+        {
+            if (engine == null) throw new ArgumentNullException(nameof(engine));
+
+            var values = new PrimitiveValue[ReadCount];
+            var result = new object[ReadCount];
+            Int32 resultCount = 0;
+            HandleProxy* error;
+
+            fixed (byte* pData = _Data)
+            fixed (PrimitiveValue* pValues = values)
+            {
+                error = V8NetProxy.ExecuteCommandBuffer(engine._NativeV8EngineProxy, pData, _Length, pValues, values.Length, &resultCount);
+                try
+                {
+                    for (var i = 0; i < resultCount; i++)
+                        result[i] = values[i].Value;
+                }
+                finally { V8NetProxy.FreePrimitiveValues(pValues, resultCount); }
+            }
+
+            if (error != null)
+            {
+                foreach (var value in result)
+                    if (value is InternalHandle)
+                        ((InternalHandle)value).Dispose();
+
+                using (var hError = new InternalHandle(error, true))
+                    hError.ThrowOnError();
+            }
+
+            return result;
+        }
+
+        // --------------------------------------------------------------------------------------------------------------------
+    }
+
+    // ========================================================================================================================
+}
@@ -0,0 +1,86 @@
+﻿using System;
+using System.Collections.Generic;
+using System.Linq;
+using System.Text;
+
+namespace V8.Net
+{
+    // ========================================================================================================================
+
+    /// <summary>
+    /// A column of values for a dataset (see 'V8Engine.CreateDataset()').  The values are not copied; the array is pinned and
+    /// used directly by scripts until the dataset is no longer referenced, so changes made to the array after the dataset is
+    /// created are seen by scripts.
+    /// </summary>
+    public sealed class DatasetColumn
+    {
+        /// <summary> The name of the column (the property name in scripts). </summary>
+        public readonly string Name;
+
+        /// <summary> The type of the column values. </summary>
+        public readonly DatasetColumnType Type;
+
+        /// <summary> The values (double[] or Int32[]; for string columns these are indexes into 'Dictionary', or -1 for null). </summary>
+        public readonly Array Data;
+
+        /// <summary> The distinct strings of a string column (null for other column types). </summary>
+        public readonly string[] Dictionary;
+
+        /// <summary> The number of rows in this column. </summary>
+        public Int32 Length { get { return Data.Length; } }
+
+        DatasetColumn(string name, DatasetColumnType type, Array data, string[] dictionary)
+        {
+            if (name == null) throw new ArgumentNullException(nameof(name));
+            if (data == null) throw new ArgumentNullException(nameof(data));
+            Name = name;
+            Type = type;
+            Data = data;
+            Dictionary = dictionary;
+        }
+
+        /// <summary> Creates a column of numbers (exposed to scripts as a Float64Array). </summary>
+        public static DatasetColumn FromNumbers(string name, double[] values) { return new DatasetColumn(name, DatasetColumnType.Number, values, null); }
+
+        /// <summary> Creates a column of integers (exposed to scripts as an Int32Array). </summary>
+        public static DatasetColumn FromIntegers(string name, Int32[] values) { return new DatasetColumn(name, DatasetColumnType.Int32, values, null); }
+
+        /// <summary>
+        /// Creates a dictionary encoded string column from indexes into a table of distinct strings (an index of -1 is a null value).
+        /// </summary>
+        public static DatasetColumn FromStrings(string name, Int32[] indexes, string[] dictionary)
+        {
+            if (dictionary == null) throw new ArgumentNullException(nameof(dictionary));
+            return new DatasetColumn(name, DatasetColumnType.String, indexes, dictionary);
+        }
+
+        /// <summary>
+        /// Creates a string column, dictionary encoding the given values (each distinct string is only passed to V8 once).
+        /// </summary>
+        public static DatasetColumn FromStrings(string name, IList<string> values)
+        {
+            if (values == null) throw new ArgumentNullException(nameof(values));
+
+            var indexes = new Int32[values.Count];
+            var dictionary = new List<string>();
+            var lookup = new Dictionary<string, Int32>();
+
+            for (var i = 0; i < indexes.Length; i++)
+            {
+                var value = values[i];
+                if (value == null) { indexes[i] = -1; continue; }
+                if (!lookup.TryGetValue(value, out var index))
+                {
+                    index = dictionary.Count;
+                    dictionary.Add(value);
+                    lookup[value] = index;
+                }
+                indexes[i] = index;
+            }
+
+            return new DatasetColumn(name, DatasetColumnType.String, indexes, dictionary.ToArray());
+        }
+    }
+
+    // ========================================================================================================================
+}
@@ -0,0 +1,50 @@
+﻿using System;
+using System.Collections.Generic;
+using System.Linq;
+using System.Text;
+
+namespace V8.Net
+{
+    // ========================================================================================================================
+
+    /// <summary>
+    /// Keeps the native isolate locked and its scopes entered across many calls into an engine from one thread (see
+    /// 'V8Engine.BeginSession()').  Dispose the session (or use it in a "using" statement) to end it.
+    /// <para>While a session is open, other threads calling into the engine wait until it ends, so keep sessions short (such as
+    /// "create an object, set its properties, call a function, and read the result").  Handles disposed by the GC during a
+    /// session are queued and disposed later.  Sessions on different engines from the same thread must end in the reverse order
+    /// they were started, and the engine context should not be changed during a session.</para>
+    /// </summary>
+    public sealed unsafe class V8EngineSession : IDisposable // (a class, so that copies share one state and the session can only end once)
+    {
+        // --------------------------------------------------------------------------------------------------------------------
+
+        /// <summary> The engine the session was opened on. </summary>
+        public V8Engine Engine { get { return _Engine; } }
+        V8Engine _Engine;
+
+        /// <summary> The number of nested sessions open on the engine (from this thread) when this session was started. </summary>
+        public readonly int Depth;
+
+        internal V8EngineSession(V8Engine engine, int depth)
+        {
+            _Engine = engine;
+            Depth = depth;
+        }
+
+        /// <summary> Ends the session.  Nothing is done if the session was already ended or the engine is disposed. </summary>
+        public void Dispose()
+        {
+            if (_Engine != null)
+            {
+                if (!_Engine.IsDisposed)
+                    V8NetProxy.EndSession(_Engine._NativeV8EngineProxy);
+                _Engine = null;
+            }
+        }
+
+        // --------------------------------------------------------------------------------------------------------------------
+    }
+
+    // ========================================================================================================================
+}
@@ -195,6 +195,227 @@ namespace V8.Net
 
     // ========================================================================================================================
 
+    /// <summary>
+    /// The parts of a script error that can be read separately from an error handle (see 'InternalHandle.GetErrorField()').
+    /// </summary>
+    public enum ScriptErrorField : int
+    {
+        /// <summary>
+        /// The error message, without any location details.
+        /// </summary>
+        Message,
+
+        /// <summary>
+        /// The resource name of the script the error occurred in.
+        /// </summary>
+        ScriptName,
+
+        /// <summary>
+        /// The line of source code the error occurred on.
+        /// </summary>
+        SourceLine,
+
+        /// <summary>
+        /// The stack trace (without the leading error message), if any.
+        /// </summary>
+        Stack,
+
+        /// <summary>
+        /// The exception value that was thrown.
+        /// </summary>
+        Exception
+    }
+
+    // ========================================================================================================================
+
+    /// <summary>
+    /// The value tags used by the native binary serialization format (see 'ObjectSerializer').
+    /// Note: This must match the 'SerializedType' enum on the native side.
+    /// </summary>
+    public enum SerializedType : byte
+    {
+        Undefined, // (also used for values that cannot be serialized, such as functions and symbols)
+        Null,
+        False,
+        True,
+        Int32,
+        Number,
+        String,
+        Date,
+        Array,
+        Object
+    }
+
+    /// <summary>
+    /// Error results returned from the native serialization exports.
+    /// </summary>
+    public enum SerializerResult : int
+    {
+        Success = 0,
+        InvalidValue = -1,
+        CycleDetected = -2,
+        MaxDepthExceeded = -3,
+        MaxSizeExceeded = -4,
+        ScriptError = -5
+    }
+
+    // ========================================================================================================================
+
+    /// <summary>
+    /// The element types of views that can be created over array buffers (see 'V8Engine.CreateTypedArray()').
+    /// Note: This must match the 'TypedArrayType' enum on the native side.
+    /// </summary>
+    public enum TypedArrayType : int
+    {
+        Int8,
+        Uint8,
+        Uint8Clamped,
+        Int16,
+        Uint16,
+        Int32,
+        Uint32,
+        Float32,
+        Float64,
+
+        /// <summary>
+        /// A 'DataView' (not a typed array, but also a view over an array buffer; the length is in bytes).
+        /// </summary>
+        DataView
+    }
+
+    /// <summary>
+    /// The value types of direct accessors, which read and write memory directly without calling back into managed code (see
+    /// 'ObjectTemplate.SetDirectAccessor()').
+    /// Note: This must match the 'DirectAccessorType' enum on the native side.
+    /// </summary>
+    public enum DirectAccessorType : int
+    {
+        /// <summary> A 1 byte boolean (0 is false). </summary>
+        Boolean,
+        Byte,
+        Int16,
+        UInt16,
+        Int32,
+        UInt32,
+        /// <summary> Read as a JavaScript number, so values past 2^53 lose precision. </summary>
+        Int64,
+        Float,
+        Double
+    }
+
+    /// <summary>
+    /// Flags a managed callback can return to the native side in 'ManagedAccessorInfo.ResultFlags'.
+    /// Note: This must match the 'ManagedAccessorResultFlags' enum on the native side.
+    /// </summary>
+    [Flags]
+    public enum ManagedAccessorResultFlags : int
+    {
+        None = 0,
+
+        /// <summary>
+        /// (named property getters only) The returned value can be cached on the native side, so repeated reads by scripts don't call
+        /// back into managed code until the cache is invalidated (see 'IV8CacheableProperties').
+        /// </summary>
+        Cacheable = 1
+    }
+
+    /// <summary>
+    /// The signatures of primitive function callbacks (see 'FunctionTemplate.SetPrimitiveCallback()').
+    /// Note: This must match the 'PrimitiveSignature' enum on the native side.
+    /// </summary>
+    public enum PrimitiveSignature : int
+    {
+        None,
+        Number1,
+        Number2,
+        Int32_1,
+        Int32_2,
+        NumberArray
+    }
+
+    /// <summary>
+    /// The column types of a dataset (see 'V8Engine.CreateDataset()').
+    /// Note: This must match the 'DatasetColumnType' enum on the native side.
+    /// </summary>
+    public enum DatasetColumnType : int
+    {
+        /// <summary> Double values (exposed to scripts as a Float64Array). </summary>
+        Number,
+        /// <summary> Int32 values (exposed to scripts as an Int32Array). </summary>
+        Int32,
+        /// <summary> Indexes into a table of distinct strings (-1 for null; the indexes are exposed to scripts as an Int32Array). </summary>
+        String
+    }
+
+    /// <summary>
+    /// The field types of an object shape (see 'ObjectShape').  Fields are packed in order with no padding, using these sizes:
+    /// Boolean = 1 byte, Int32 = 4 bytes, Number and Date (ms since epoch) = 8 bytes, and String (a null terminated UTF-16 string
+    /// pointer) and Handle (a handle proxy pointer) = 8 bytes (the pointers are stored as 64-bit values on all platforms).
+    /// Note: This must match the 'ShapeFieldType' enum on the native side.
+    /// </summary>
+    public enum ShapeFieldType : int
+    {
+        Boolean,
+        Int32,
+        Number,
+        Date,
+        String,
+
+        /// <summary>
+        /// Any value (a handle is created when extracting).
+        /// </summary>
+        Handle
+    }
+
+    /// <summary>
+    /// Options for creating a <see cref="V8Engine"/> instance.
+    /// Note: This must match the 'EngineFlags' enum on the native side.
+    /// </summary>
+    [Flags]
+    public enum V8EngineFlags : int
+    {
+        None = 0,
+
+        /// <summary>
+        /// The engine is owned by the thread that creates it.  The native isolate is locked (and the context entered) once instead of
+        /// on every call, which skips the V8 locker on each call into the engine.  Only the creating thread may use the engine,
+        /// and it must also dispose it.  Native debug builds assert this.
+        /// <para>Warning: The GC cannot destroy a thread-affine engine (it finalizes on its own thread), so an engine that is never
+        /// disposed leaks its native isolate, and the lock held on it, for the life of the process.  Templates and handles finalized
+        /// by the GC are queued and released the next time the owner thread calls into the engine.</para>
+        /// </summary>
+        ThreadAffine = 1
+    }
+
+    /// <summary>
+    /// The commands run by 'CommandBuffer'.  Each command works on a value stack; the comments show the operands that follow the
+    /// op code, then the stack [before] -> [after], with the top of the stack on the right.
+    /// Note: This must match the 'CommandOpCode' enum on the native side.
+    /// </summary>
+    public enum CommandOpCode : byte
+    {
+        End, // (stops running the commands; optional)
+        PushUndefined, // [] -> [undefined]
+        PushNull, // [] -> [null]
+        PushBool, // byte: [] -> [value]
+        PushInt32, // int32: [] -> [value]
+        PushNumber, // double: [] -> [value]
+        PushString, // int32 length + UTF16 characters: [] -> [value]
+        PushHandle, // int32 engine ID + int32 handle ID (-1 for undefined) + int32 handle generation: [] -> [value]
+        PushGlobal, // [] -> [global object]
+        CreateObject, // [] -> [object]
+        CreateArray, // int32 length: [] -> [array]
+        Dup, // [value] -> [value, value]
+        Pop, // [value] -> []
+        GetProperty, // int32 name ID: [object] -> [value]
+        SetProperty, // int32 name ID: [object, value] -> [object]
+        GetIndex, // int32 index: [object] -> [value]
+        SetIndex, // int32 index: [object, value] -> [object]
+        Call, // int32 argument count: [function, this, arguments...] -> [result]
+        CallMethod, // int32 name ID + int32 argument count: [object, arguments...] -> [result]
+        Read // [value] -> [] (the value is returned from 'Execute()')
+    }
+
     /// <summary>
     /// Type of native proxy object (for native class instances only).
     /// </summary>
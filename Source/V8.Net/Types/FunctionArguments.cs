@@ -0,0 +1,118 @@
+﻿using System;
+using System.Collections.Generic;
+using System.Linq;
+using System.Text;
+
+namespace V8.Net
+{
+    // ========================================================================================================================
+
+    /// <summary>
+    /// A view over the arguments of a JavaScript function call (see 'FunctionTemplate.SetArgumentsCallback()').  Nothing is
+    /// marshalled until requested: primitive arguments can be read directly as values, and a handle is only created for an
+    /// argument (or 'This') the first time it is requested.
+    /// <para>The view is only valid during the call.  As with regular callbacks, the handles it returns are disposed when the
+    /// call returns, so call 'KeepAlive()' (or clone them) to keep them any longer.</para>
+    /// </summary>
+    public unsafe struct FunctionArguments
+    {
+        // --------------------------------------------------------------------------------------------------------------------
+
+        readonly NativeCallbackArguments* _Args;
+
+        /// <summary> The engine the function was called in. </summary>
+        public readonly V8Engine Engine;
+
+        /// <summary> The number of arguments given in the call. </summary>
+        public readonly Int32 Length;
+
+        internal FunctionArguments(V8Engine engine, NativeCallbackArguments* args, Int32 length)
+        {
+            Engine = engine;
+            _Args = args;
+            Length = length;
+        }
+
+        // --------------------------------------------------------------------------------------------------------------------
+
+        /// <summary> The 'this' object of the call (a handle is created on first request). </summary>
+        public InternalHandle This { get { return V8NetProxy.GetCallbackThis(_Args); } }
+
+        /// <summary> Returns a handle for the argument at the given index (created on first request). </summary>
+        public InternalHandle this[int index]
+        {
+            get
+            {
+                if (index < 0 || index >= Length) throw new ArgumentOutOfRangeException("index");
+                return V8NetProxy.GetCallbackArgument(_Args, index);
+            }
+        }
+
+        /// <summary>
+        /// Reads an argument as a tagged value, without creating a handle for primitive values (undefined, null, booleans, numbers,
+        /// strings, and dates).  Any string returned must be freed using 'V8NetProxy.FreePrimitiveValues()' (or use the typed methods instead).
+        /// Handles returned for other values are owned by the call.  Indexes out of range return 'undefined' (as in JavaScript).
+        /// </summary>
+        public PrimitiveValue GetValue(int index)
+        {
+            PrimitiveValue value;
+            V8NetProxy.GetCallbackArgumentValue(_Args, index, &value);
+            return value;
+        }
+
+        /// <summary> Returns the type of an argument (no handle is created for primitive values). </summary>
+        public JSValueType GetValueType(int index)
+        {
+            var value = GetValue(index);
+            if (value.Type == JSValueType.String) V8NetProxy.FreePrimitiveValues(&value, 1);
+            return value.Type;
+        }
+
+        /// <summary> Reads a numeric argument (Int32 or Number).  Returns false if the argument is not a number. </summary>
+        public bool TryGetNumber(int index, out double number)
+        {
+            var value = GetValue(index);
+            switch (value.Type)
+            {
+                case JSValueType.Int32: number = (Int32)value.V8Integer; return true;
+                case JSValueType.Number: number = value.V8Number; return true;
+                case JSValueType.String: V8NetProxy.FreePrimitiveValues(&value, 1); break;
+            }
+            number = double.NaN;
+            return false;
+        }
+
+        /// <summary> Reads an Int32 argument.  Returns false if the argument is not a 32-bit integer. </summary>
+        public bool TryGetInt32(int index, out Int32 number)
+        {
+            var value = GetValue(index);
+            if (value.Type == JSValueType.Int32) { number = (Int32)value.V8Integer; return true; }
+            if (value.Type == JSValueType.String) V8NetProxy.FreePrimitiveValues(&value, 1);
+            number = 0;
+            return false;
+        }
+
+        /// <summary> Reads a boolean argument.  Returns false if the argument is not a boolean. </summary>
+        public bool TryGetBoolean(int index, out bool b)
+        {
+            var value = GetValue(index);
+            if (value.Type == JSValueType.Bool) { b = value.V8Boolean != 0; return true; }
+            if (value.Type == JSValueType.String) V8NetProxy.FreePrimitiveValues(&value, 1);
+            b = false;
+            return false;
+        }
+
+        /// <summary> Reads a string argument.  Returns null if the argument is not a string. </summary>
+        public string GetString(int index)
+        {
+            var value = GetValue(index);
+            if (value.Type != JSValueType.String) return null;
+            try { return value.V8String != null ? new string((char*)value.V8String) : ""; }
+            finally { V8NetProxy.FreePrimitiveValues(&value, 1); }
+        }
+
+        // --------------------------------------------------------------------------------------------------------------------
+    }
+
+    // ========================================================================================================================
+}
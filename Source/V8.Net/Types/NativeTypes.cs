@@ -46,6 +46,34 @@ namespace V8.Net
         public void* NativeFucntionTemplate;
     }
 
+    /// <summary>
+    /// Counters for the native argument buffers used when calling between JavaScript and the managed side (see
+    /// 'V8Engine.GetArgumentBufferStats()').  'HeapAllocations' stops increasing once the buffers have grown to fit the largest
+    /// argument lists used, so the calls themselves never allocate.
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential, Pack = 1)]
+    public struct ArgumentBufferStats
+    {
+        /// <summary> Argument lists that fit in the inline (stack) storage. </summary>
+        public Int64 InlineUses;
+        /// <summary> Larger argument lists taken from the engine's reusable argument arena. </summary>
+        public Int64 ArenaUses;
+        /// <summary> Memory blocks the arena had to allocate. </summary>
+        public Int64 HeapAllocations;
+    }
+
+    // ========================================================================================================================
+
+    /// <summary>
+    /// A native view over the arguments of a function call (see 'FunctionArguments').  Only valid during the call.
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential, Pack = 1)]
+    public unsafe struct NativeCallbackArguments
+    {
+        public void* NativeEngineProxy;
+        public void* NativeFunctionCallbackInfo;
+    }
+
     // ========================================================================================================================
 
     [StructLayout(LayoutKind.Sequential, Pack = 1)]
@@ -53,12 +81,13 @@ namespace V8.Net
     {
         public NativeObjectTemplateProxy* NativeObjectTemplateProxy;
         public Int32 ManagedObjectID; // This is ALWAYS set to a manage object ID (index) that is associated with the call-back process for objects created from templates.
+        public ManagedAccessorResultFlags ResultFlags; // (set before returning to tell the native side how the result can be used)
 
     }
 
     // ========================================================================================================================
 
-    [StructLayout(LayoutKind.Explicit, Pack = 1, Size = 64)]
+    [StructLayout(LayoutKind.Explicit, Pack = 1, Size = 72)]
     public unsafe struct HandleProxy
     {
         // --------------------------------------------------------------------------------------------------------------------
@@ -87,7 +116,7 @@ namespace V8.Net
         [FieldOffset(20)]
         public double V8Number; // (also used with Date milliseconds since epoch [Jan 1, 1970  00:00:00])
         [FieldOffset(28)]
-        public void* V8String; // (for strings and objects, this is the ToString() value [Unicode characters (2 bytes each)])
+        public void* V8String; // (for strings and objects, this is the ToString() value [Unicode characters (2 bytes each)]; for dates and objects this is only set by 'V8NetProxy.UpdateHandleValueText()')
         #endregion
 
         [FieldOffset(36), MarshalAs(UnmanagedType.I4)]
@@ -99,10 +128,16 @@ namespace V8.Net
         [FieldOffset(44), MarshalAs(UnmanagedType.I4)]
         public Int32 EngineID;
 
-        [FieldOffset(48)]
-        public void* NativeEngineProxy; // Pointer to the native V8 engine proxy object associated with this proxy handle instance (used native side to free the handle upon destruction).
+        [FieldOffset(48), MarshalAs(UnmanagedType.I4)]
+        public Int32 ValueIsCurrent; // 1 if the value fields are already set (for values that never change), so 'V8NetProxy.UpdateHandleValue()' is not needed.
+
+        [FieldOffset(52), MarshalAs(UnmanagedType.I4)]
+        public Int32 Generation; // Incremented each time the handle is disposed (so a recorded ID can be checked against reuse).
 
         [FieldOffset(56)]
+        public void* NativeEngineProxy; // Pointer to the native V8 engine proxy object associated with this proxy handle instance (used native side to free the handle upon destruction).
+
+        [FieldOffset(64)]
         public void* NativeV8Handle; // The native V8 persistent object handle (not used on the managed side).
 
         // --------------------------------------------------------------------------------------------------------------------
@@ -163,6 +198,186 @@ namespace V8.Net
 
     // ========================================================================================================================
 
+    /// <summary>
+    /// A value passed by value to and from the native side for bulk operations (such as 'InternalHandle.GetProperties()'), which
+    /// avoids creating a native handle proxy for every value.  Undefined, null, boolean, number, string, and date values are
+    /// stored directly.  For all other types 'Handle' references a handle proxy for the value.
+    /// </summary>
+    [StructLayout(LayoutKind.Explicit, Pack = 1, Size = 20)]
+    public unsafe struct PrimitiveValue
+    {
+        [FieldOffset(0), MarshalAs(UnmanagedType.I4)]
+        public JSValueType Type;
+
+        [FieldOffset(4), MarshalAs(UnmanagedType.I1)]
+        public Byte V8Boolean;
+        [FieldOffset(4), MarshalAs(UnmanagedType.I8)]
+        public Int64 V8Integer;
+        [FieldOffset(4)]
+        public double V8Number; // (also used with Date milliseconds since epoch [Jan 1, 1970  00:00:00])
+
+        [FieldOffset(12)]
+        public void* V8String; // (strings returned from the native side must be freed by calling 'V8NetProxy.FreePrimitiveValues()')
+        [FieldOffset(12)]
+        public HandleProxy* Handle; // (for non-primitive values)
+
+        /// <summary> True if this value is passed as a handle (i.e. is not a primitive value). </summary>
+        public bool IsHandle
+        {
+            get
+            {
+                switch (Type)
+                {
+                    case JSValueType.Uninitialized:
+                    case JSValueType.Undefined:
+                    case JSValueType.Null:
+                    case JSValueType.Bool:
+                    case JSValueType.Int32:
+                    case JSValueType.Number:
+                    case JSValueType.String:
+                    case JSValueType.Date:
+                        return false;
+                    default: return true;
+                }
+            }
+        }
+
+        /// <summary>
+        /// Returns the CLR value for primitive values (dates are returned as a 'DateTime' value), or an 'InternalHandle' for any
+        /// other value (which the caller is responsible for disposing).
+        /// </summary>
+        public object Value
+        {
+            get
+            {
+                switch (Type)
+                {
+                    case JSValueType.Uninitialized:
+                    case JSValueType.Undefined: return null;
+                    case JSValueType.Null: return null;
+                    case JSValueType.Bool: return V8Boolean != 0;
+                    case JSValueType.Int32: return (Int32)V8Integer;
+                    case JSValueType.Number: return V8Number;
+                    case JSValueType.String: return V8String != null ? new string((char*)V8String) : null;
+                    case JSValueType.Date: return V8Engine.Epoch + TimeSpan.FromMilliseconds(V8Number);
+                    default: return new InternalHandle(Handle, true);
+                }
+            }
+        }
+
+        /// <summary>
+        /// Creates a value to pass to the native side.  Supported types are null, bool, numeric types, strings, DateTime, and
+        /// InternalHandle (or any IHandleBased object).  Strings are copied to native memory, which must be freed by calling
+        /// 'Free()' when done.
+        /// <para>Note: Handles are always passed with the type 'Object' (the native side only needs to know the value is a handle).
+        /// As with 'SetProperty()', handles passed to the native side are disposed after use unless they are tracked.</para>
+        /// </summary>
+        public static PrimitiveValue From(object value)
+        {
+            var result = new PrimitiveValue();
+
+            if (value == null) result.Type = JSValueType.Null;
+            else if (value is bool) { result.Type = JSValueType.Bool; result.V8Boolean = (bool)value ? (byte)1 : (byte)0; }
+            else if (value is Int32 || value is Int16 || value is UInt16 || value is byte || value is sbyte) { result.Type = JSValueType.Int32; result.V8Integer = Convert.ToInt32(value); }
+            else if (value is double || value is float || value is Int64 || value is UInt32 || value is UInt64 || value is decimal) { result.Type = JSValueType.Number; result.V8Number = Convert.ToDouble(value); }
+            else if (value is string) { result.Type = JSValueType.String; result.V8String = (void*)Marshal.StringToHGlobalUni((string)value); }
+            else if (value is DateTime) { result.Type = JSValueType.Date; result.V8Number = ((DateTime)value).ToUniversalTime().Subtract(V8Engine.Epoch).TotalMilliseconds; }
+            else if (value is InternalHandle) { var h = (InternalHandle)value; result.Handle = h; result.Type = h.IsEmpty ? JSValueType.Undefined : JSValueType.Object; }
+            else if (value is IHandleBased) { var h = ((IHandleBased)value).InternalHandle; result.Handle = h; result.Type = h.IsEmpty ? JSValueType.Undefined : JSValueType.Object; }
+            else throw new InvalidOperationException("The value type '" + value.GetType().Name + "' cannot be passed as a primitive value.");
+
+            return result;
+        }
+
+        /// <summary> Frees the string memory allocated by 'From()' (if any). </summary>
+        public void Free()
+        {
+            if (Type == JSValueType.String && V8String != null)
+            {
+                Marshal.FreeHGlobal((IntPtr)V8String);
+                V8String = null;
+            }
+        }
+    }
+
+    // ========================================================================================================================
+
+    /// <summary>
+    /// Allocation statistics for the array buffer memory of an engine (see 'V8Engine.GetArrayBufferAllocatorStats()').
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential)]
+    public struct ArrayBufferAllocatorStats
+    {
+        /// <summary> The bytes currently allocated for array buffers (not including buffers over external memory). </summary>
+        public Int64 AllocatedBytes;
+        /// <summary> The highest value 'AllocatedBytes' has reached. </summary>
+        public Int64 PeakBytes;
+        /// <summary> The bytes held in the pool of freed blocks for reuse. </summary>
+        public Int64 PooledBytes;
+        /// <summary> The limit for 'AllocatedBytes' (0 if there is no limit). </summary>
+        public Int64 MaxBytes;
+        /// <summary> The number of successful allocations. </summary>
+        public Int64 AllocationCount;
+        /// <summary> The number of allocations refused because of the limit (scripts get a 'RangeError' for these). </summary>
+        public Int64 FailedAllocationCount;
+    }
+
+    // ========================================================================================================================
+
+    /// <summary>
+    /// Options for the V8 platform shared by all engines in the process (see 'V8Engine.ConfigurePlatform()').
+    /// Note: This must match the 'PlatformOptions' struct on the native side.
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential)]
+    public struct PlatformOptions
+    {
+        /// <summary> The number of worker threads for background tasks (0 to use the number of processors less one, up to 8). </summary>
+        public Int32 WorkerCount;
+        /// <summary> The OS priority of the worker threads (a Windows 'THREAD_PRIORITY_...' value; 0 is normal). </summary>
+        public Int32 ThreadPriority;
+        /// <summary> The processors the worker threads may run on, one bit per processor (0 for any). </summary>
+        public UInt64 AffinityMask;
+    }
+
+    /// <summary>
+    /// Task statistics for the V8 platform shared by all engines in the process (see 'V8Engine.GetPlatformStats()').
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential)]
+    public struct PlatformStats
+    {
+        /// <summary> The number of worker threads (0 if no engine was created yet). </summary>
+        public Int32 WorkerCount;
+        /// <summary> The number of tasks running on the worker threads right now. </summary>
+        public Int32 RunningTasks;
+        /// <summary> The number of tasks waiting for a worker thread. </summary>
+        public Int64 QueuedTasks;
+        /// <summary> The number of tasks waiting for their delay to expire. </summary>
+        public Int64 DelayedTasks;
+        /// <summary> The number of tasks that have finished running. </summary>
+        public Int64 CompletedTasks;
+        /// <summary> The average time in milliseconds tasks have waited in the queue before they started running. </summary>
+        public double AverageLatency;
+        /// <summary> The longest time in milliseconds a task has waited in the queue before it started running. </summary>
+        public double MaxLatency;
+    }
+
+    // ========================================================================================================================
+
+    /// <summary>
+    /// Describes one column of a dataset for the native side (see 'V8Engine.CreateDataset()').
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential, Pack = 1)]
+    public unsafe struct DatasetColumnInfo
+    {
+        public char* Name;
+        public DatasetColumnType Type;
+        public void* Data;
+        public char** Dictionary;
+        public Int32 DictionarySize;
+    }
+
+    // ========================================================================================================================
+
     /// <summary>
     /// NamedProperty[Getter|Setter] are used as interceptors on object.
     /// See ObjectTemplate::SetNamedPropertyHandler.
@@ -257,6 +472,9 @@ namespace V8.Net
 
     [UnmanagedFunctionPointer(CallingConvention.StdCall)]
     public unsafe delegate HandleProxy* NativeFunctionCallback(Int32 managedObjectID, [MarshalAs(UnmanagedType.I1)]bool isConstructCall, HandleProxy* _this, HandleProxy** args, Int32 argCount);
+
+    [UnmanagedFunctionPointer(CallingConvention.StdCall)]
+    public unsafe delegate HandleProxy* NativeFunctionArgsCallback(Int32 managedObjectID, [MarshalAs(UnmanagedType.I1)]bool isConstructCall, NativeCallbackArguments* args, Int32 argCount);
     // ('IntPtr' == HandleProxy*)
 
     // ========================================================================================================================
@@ -270,4 +488,44 @@ namespace V8.Net
     public unsafe delegate bool V8GarbageCollectionRequestCallback(HandleProxy* objectToBeCollected);
 
     // ========================================================================================================================
+
+    /// <summary>
+    /// Receives text output from the native side in chunks (UTF-16 characters, or UTF-8 bytes, depending on the request; 'length'
+    /// is in those units).  Return false to stop writing.
+    /// </summary>
+    [UnmanagedFunctionPointer(CallingConvention.StdCall)]
+    [return: MarshalAs(UnmanagedType.I1)]
+    public unsafe delegate bool NativeWriteCallback(void* data, Int32 length);
+
+    /// <summary>
+    /// Called when V8 no longer references an array buffer created over managed (or other external) memory, or when the engine is
+    /// disposed.  This may be called during a V8 garbage collection, so the engine must NOT be accessed from within the callback.
+    /// </summary>
+    [UnmanagedFunctionPointer(CallingConvention.StdCall)]
+    public unsafe delegate void NativeReleaseCallback(void* data, Int64 length, Int32 releaseID);
+
+    // ========================================================================================================================
+    // Primitive function callbacks (see 'FunctionTemplate.SetPrimitiveCallback()').  These are called directly with the argument
+    // values, so no handles are created for the arguments, 'this', or the result.
+
+    [UnmanagedFunctionPointer(CallingConvention.StdCall)]
+    public delegate double PrimitiveNumberFunction(double a);
+
+    [UnmanagedFunctionPointer(CallingConvention.StdCall)]
+    public delegate double PrimitiveNumberFunction2(double a, double b);
+
+    [UnmanagedFunctionPointer(CallingConvention.StdCall)]
+    public delegate Int32 PrimitiveInt32Function(Int32 a);
+
+    [UnmanagedFunctionPointer(CallingConvention.StdCall)]
+    public delegate Int32 PrimitiveInt32Function2(Int32 a, Int32 b);
+
+    /// <summary>
+    /// Receives any number of numeric arguments (up to 'FunctionTemplate.MaxPrimitiveArguments').  The 'args' memory is only valid
+    /// during the call.
+    /// </summary>
+    [UnmanagedFunctionPointer(CallingConvention.StdCall)]
+    public unsafe delegate double PrimitiveNumberArrayFunction(double* args, Int32 argCount);
+
+    // ========================================================================================================================
 }
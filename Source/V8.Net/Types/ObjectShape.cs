@@ -0,0 +1,212 @@
+﻿using System;
+using System.Collections.Generic;
+using System.Linq;
+using System.Runtime.InteropServices;
+using System.Text;
+
+namespace V8.Net
+{
+    // ========================================================================================================================
+
+    /// <summary>
+    /// A fixed schema for objects (an ordered list of property names and their expected types), registered once per engine using
+    /// 'V8Engine.RegisterShape()'.  Objects of the shape can then be read into, or created from, a packed struct in a single native
+    /// call, instead of one call per property.  The property names are internalized once on the native side, and objects created
+    /// from the shape all share the same hidden class.
+    /// <para>The struct is packed in field order with no padding (see 'ShapeFieldType' for the size of each field), so a managed
+    /// struct can be used directly if it is declared with 'StructLayout(LayoutKind.Sequential, Pack = 1)' and matching fields.</para>
+    /// </summary>
+    public unsafe sealed class ObjectShape
+    {
+        // --------------------------------------------------------------------------------------------------------------------
+
+        public readonly V8Engine Engine;
+
+        /// <summary> The ID of this shape within its engine. </summary>
+        public readonly Int32 ID;
+
+        /// <summary> The property names of this shape. </summary>
+        public readonly string[] Names;
+
+        /// <summary> The expected types of the properties. </summary>
+        public readonly ShapeFieldType[] Types;
+
+        /// <summary> The offset of each field within the packed struct. </summary>
+        public readonly Int32[] Offsets;
+
+        /// <summary> The size of the packed struct in bytes. </summary>
+        public readonly Int32 Size;
+
+        // --------------------------------------------------------------------------------------------------------------------
+
+        internal ObjectShape(V8Engine engine, Int32 id, string[] names, ShapeFieldType[] types)
+        {
+            Engine = engine;
+            ID = id;
+            Names = names;
+            Types = types;
+            Offsets = new Int32[types.Length];
+
+            for (var i = 0; i < types.Length; i++)
+            {
+                Offsets[i] = Size;
+                Size += GetFieldSize(types[i]);
+            }
+        }
+
+        /// <summary>
+        /// Returns the size of a field of the given type within the packed struct.
+        /// </summary>
+        public static Int32 GetFieldSize(ShapeFieldType type)
+        {
+            switch (type)
+            {
+                case ShapeFieldType.Boolean: return 1;
+                case ShapeFieldType.Int32: return 4;
+                default: return 8;
+            }
+        }
+
+        // --------------------------------------------------------------------------------------------------------------------
+
+        /// <summary>
+        /// Reads the properties of an object into a packed struct (at least 'Size' bytes), and returns the number of properties
+        /// that didn't have the expected type (those are set to 0, NaN, or null).
+        /// <para>Note: Any strings in the struct are allocated natively, and must be released using 'FreeValues()'. Any handles
+        /// in the struct (for 'ShapeFieldType.Handle' fields) must be disposed by the caller.</para>
+        /// </summary>
+        public Int32 Extract(InternalHandle obj, byte* buffer, Int32 bufferSize)
+        {
+            if (obj.IsEmpty) throw new ArgumentNullException(nameof(obj));
+            Int32 mismatches;
+            InternalHandle error = V8NetProxy.ExtractShape(obj, ID, buffer, bufferSize, &mismatches);
+            error.ThrowOnError();
+            return mismatches;
+        }
+
+        /// <summary>
+        /// Reads the properties of an object and returns the values in field order (booleans = bool, integers = Int32, numbers =
+        /// double, dates = DateTime (UTC), strings = string, and handles = InternalHandle [which must be disposed by the caller]).
+        /// Number, Date, and String properties that don't have the expected type are returned as null.  Boolean and Int32 fields
+        /// have no value to flag this, so they are returned as false and 0 (use the other overload to get the mismatch count).
+        /// </summary>
+        public object[] Extract(InternalHandle obj)
+        {
+            var values = new object[Types.Length];
+            var buffer = stackalloc byte[Size];
+
+            Extract(obj, buffer, Size);
+
+            var completed = false;
+
+            try
+            {
+                for (var i = 0; i < Types.Length; i++)
+                {
+                    var field = buffer + Offsets[i];
+
+                    switch (Types[i])
+                    {
+                        case ShapeFieldType.Boolean: values[i] = *field != 0; break;
+                        case ShapeFieldType.Int32: values[i] = *(Int32*)field; break;
+                        case ShapeFieldType.Number: { var n = *(double*)field; values[i] = double.IsNaN(n) ? null : (object)n; break; }
+                        case ShapeFieldType.Date: { var ms = *(double*)field; values[i] = double.IsNaN(ms) ? null : (object)V8Engine.Epoch.AddMilliseconds(ms); break; }
+                        case ShapeFieldType.String: { var str = *(Int64*)field; values[i] = str != 0 ? Marshal.PtrToStringUni((IntPtr)str) : null; break; }
+                        case ShapeFieldType.Handle: values[i] = (InternalHandle)(HandleProxy*)*(Int64*)field; break;
+                    }
+                }
+
+                completed = true;
+            }
+            finally
+            {
+                if (!completed) // (the caller never gets the handles, so release them all [including any not converted yet])
+                    for (var i = 0; i < Types.Length; i++)
+                        if (Types[i] == ShapeFieldType.Handle)
+                            ((InternalHandle)(HandleProxy*)*(Int64*)(buffer + Offsets[i])).TryDispose();
+
+                FreeValues(buffer);
+            }
+
+            return values;
+        }
+
+        /// <summary>
+        /// Frees any strings in a packed struct filled in by 'Extract()'.
+        /// </summary>
+        public void FreeValues(byte* buffer)
+        {
+            V8NetProxy.FreeShapeValues(Engine._NativeV8EngineProxy, ID, buffer);
+        }
+
+        // --------------------------------------------------------------------------------------------------------------------
+
+        /// <summary>
+        /// Creates an object of this shape from a packed struct (at least 'Size' bytes).  Strings must be null terminated UTF-16
+        /// strings (or null), and handles passed in are disposed once set (if no longer in use, as with other handles passed in).
+        /// </summary>
+        public InternalHandle Create(byte* buffer)
+        {
+            InternalHandle handle = V8NetProxy.CreateFromShape(Engine._NativeV8EngineProxy, ID, buffer);
+            handle.ThrowOnError();
+            return handle;
+        }
+
+        /// <summary>
+        /// Creates an object of this shape from the given values (in field order).  Null values are set as 0, false, NaN, or null
+        /// depending on the field type.
+        /// </summary>
+        public InternalHandle Create(params object[] values)
+        {
+            if (values == null) throw new ArgumentNullException(nameof(values));
+            if (values.Length != Types.Length) throw new ArgumentException("Expected " + Types.Length + " values for this shape.", nameof(values));
+
+            var buffer = stackalloc byte[Size];
+            var strings = new List<IntPtr>();
+
+            try
+            {
+                for (var i = 0; i < Types.Length; i++)
+                {
+                    var field = buffer + Offsets[i];
+                    var value = values[i];
+
+                    switch (Types[i])
+                    {
+                        case ShapeFieldType.Boolean: *field = (byte)(value != null && Convert.ToBoolean(value) ? 1 : 0); break;
+                        case ShapeFieldType.Int32: *(Int32*)field = value != null ? Convert.ToInt32(value) : 0; break;
+                        case ShapeFieldType.Number: *(double*)field = value != null ? Convert.ToDouble(value) : double.NaN; break;
+                        case ShapeFieldType.Date:
+                            *(double*)field = value is DateTime date ? (date.ToUniversalTime() - V8Engine.Epoch).TotalMilliseconds
+                                : value != null ? Convert.ToDouble(value) : double.NaN;
+                            break;
+                        case ShapeFieldType.String:
+                        {
+                            var str = value != null ? Marshal.StringToHGlobalUni(value.ToString()) : IntPtr.Zero;
+                            if (str != IntPtr.Zero) strings.Add(str);
+                            *(Int64*)field = (Int64)str;
+                            break;
+                        }
+                        case ShapeFieldType.Handle:
+                        {
+                            InternalHandle h = value is InternalHandle ih ? ih : value is Handle hh ? (InternalHandle)hh : value != null ? Engine.CreateValue(value) : InternalHandle.Empty;
+                            *(Int64*)field = (Int64)(HandleProxy*)h;
+                            break;
+                        }
+                    }
+                }
+
+                return Create(buffer);
+            }
+            finally
+            {
+                foreach (var str in strings)
+                    Marshal.FreeHGlobal(str);
+            }
+        }
+
+        // --------------------------------------------------------------------------------------------------------------------
+    }
+
+    // ========================================================================================================================
+}
@@ -0,0 +1,397 @@
+﻿using System;
+using System.Collections;
+using System.Collections.Generic;
+using System.Linq;
+using System.Runtime.InteropServices;
+using System.Text;
+
+namespace V8.Net
+{
+    // ========================================================================================================================
+
+    /// <summary>
+    /// Converts JavaScript values (including whole object graphs) to and from managed values using a single native call.  The
+    /// native side walks the value once and writes a compact tagged binary format, which is then decoded here without any further
+    /// calls (and the reverse when creating values).
+    /// <para>Values are decoded as: undefined and null = null, booleans = bool, integers = Int32, numbers = double, strings =
+    /// string, dates = DateTime (UTC), arrays = object[], and objects = Dictionary&lt;string, object&gt;.  Functions and symbols are
+    /// decoded as null.</para>
+    /// <para>When encoding, any integer type that fits is written as an Int32, other numbers as doubles, chars as strings,
+    /// dictionaries as objects (the keys are converted to strings), and any other enumerable as an array.</para>
+    /// </summary>
+    public static unsafe class ObjectSerializer
+    {
+        // --------------------------------------------------------------------------------------------------------------------
+
+        public const Int32 DefaultMaxDepth = 100;
+        public const Int32 DefaultBufferSize = 64 * 1024;
+
+        [ThreadStatic]
+        static byte[] _Buffer; // (reused for each call on the same thread; the native side allocates its own buffer if the data doesn't fit)
+
+        // --------------------------------------------------------------------------------------------------------------------
+
+        /// <summary>
+        /// Serializes the value of the given handle and returns the data.
+        /// </summary>
+        /// <param name="maxDepth"> The maximum nesting depth of objects and arrays. </param>
+        /// <param name="maxSize"> The maximum size of the data in bytes (0 for no limit). </param>
+        public static byte[] Serialize(InternalHandle handle, Int32 maxDepth = DefaultMaxDepth, Int32 maxSize = 0)
+        {
+            return _Serialize(handle, maxDepth, maxSize, (data, length) =>
+            {
+                var result = new byte[length];
+                if (length > 0)
+                    Marshal.Copy(data, result, 0, length);
+                return result;
+            });
+        }
+
+        /// <summary>
+        /// Reads the value of the given handle, and any objects it references, into managed values.
+        /// </summary>
+        /// <param name="maxDepth"> The maximum nesting depth of objects and arrays. </param>
+        /// <param name="maxSize"> The maximum size of the serialized data in bytes (0 for no limit). </param>
+        public static object Read(InternalHandle handle, Int32 maxDepth = DefaultMaxDepth, Int32 maxSize = 0)
+        {
+            return _Serialize(handle, maxDepth, maxSize, (data, length) => Deserialize((byte*)data, length));
+        }
+
+        static T _Serialize<T>(InternalHandle handle, Int32 maxDepth, Int32 maxSize, Func<IntPtr, Int32, T> reader)
+        {
+            if (handle.IsEmpty) throw new ArgumentNullException(nameof(handle));
+
+            var buffer = _Buffer ?? (_Buffer = new byte[DefaultBufferSize]);
+
+            fixed (byte* pBuffer = buffer)
+            {
+                byte* data = pBuffer;
+                Int32 capacity = buffer.Length;
+
+                var result = V8NetProxy.SerializeValue(handle, &data, &capacity, maxDepth, maxSize);
+
+                if (result < 0)
+                    throw new InvalidOperationException("Failed to serialize the value: " + _GetErrorMessage((SerializerResult)result));
+
+                try
+                {
+                    return reader((IntPtr)data, result);
+                }
+                finally
+                {
+                    if (data != pBuffer)
+                        V8NetProxy.FreeNativeMemory(data); // (the native side had to allocate a larger buffer)
+                }
+            }
+        }
+
+        static string _GetErrorMessage(SerializerResult result)
+        {
+            switch (result)
+            {
+                case SerializerResult.InvalidValue: return "The handle is not valid.";
+                case SerializerResult.CycleDetected: return "The object graph contains a cycle.";
+                case SerializerResult.MaxDepthExceeded: return "The object graph is nested too deeply.";
+                case SerializerResult.MaxSizeExceeded: return "The serialized data exceeds the maximum size.";
+                case SerializerResult.ScriptError: return "A script error occurred while reading a property.";
+                default: return "Error " + (int)result + ".";
+            }
+        }
+
+        // --------------------------------------------------------------------------------------------------------------------
+
+        /// <summary>
+        /// Decodes serialized data (as returned by 'Serialize()') into managed values.
+        /// </summary>
+        public static object Deserialize(byte[] data)
+        {
+            if (data == null) throw new ArgumentNullException(nameof(data));
+            fixed (byte* pData = data)
+                return Deserialize(pData, data.Length);
+        }
+
+        /// <summary>
+        /// Decodes serialized data into managed values.
+        /// </summary>
+        public static object Deserialize(byte* data, Int32 length)
+        {
+            Int32 pos = 0;
+            var result = _ReadValue(data, length, ref pos);
+            if (pos != length)
+                throw new FormatException("Unexpected data found after the serialized value.");
+            return result;
+        }
+
+        static void _Require(Int32 length, Int32 pos, Int32 count)
+        {
+            if (count < 0 || pos + (long)count > length)
+                throw new FormatException("Unexpected end of serialized data.");
+        }
+
+        static Int32 _ReadInt32(byte* data, Int32 length, ref Int32 pos)
+        {
+            _Require(length, pos, sizeof(Int32));
+            var value = *(Int32*)(data + pos);
+            pos += sizeof(Int32);
+            return value;
+        }
+
+        static double _ReadDouble(byte* data, Int32 length, ref Int32 pos)
+        {
+            _Require(length, pos, sizeof(double));
+            var value = *(double*)(data + pos);
+            pos += sizeof(double);
+            return value;
+        }
+
+        static string _ReadString(byte* data, Int32 length, ref Int32 pos)
+        {
+            var count = _ReadInt32(data, length, ref pos);
+            _Require(length, pos, count * sizeof(char));
+            var value = count > 0 ? new string((char*)(data + pos), 0, count) : "";
+            pos += count * sizeof(char);
+            return value;
+        }
+
+        static object _ReadValue(byte* data, Int32 length, ref Int32 pos)
+        {
+            _Require(length, pos, 1);
+
+            var tag = (SerializedType)data[pos++];
+
+            switch (tag)
+            {
+                case SerializedType.Undefined:
+                case SerializedType.Null: return null;
+                case SerializedType.False: return false;
+                case SerializedType.True: return true;
+                case SerializedType.Int32: return _ReadInt32(data, length, ref pos);
+                case SerializedType.Number: return _ReadDouble(data, length, ref pos);
+                case SerializedType.String: return _ReadString(data, length, ref pos);
+                case SerializedType.Date: return V8Engine.Epoch + TimeSpan.FromMilliseconds(_ReadDouble(data, length, ref pos));
+                case SerializedType.Array:
+                    {
+                        var count = _ReadInt32(data, length, ref pos);
+                        _Require(length, pos, count); // (each item is at least one byte)
+                        var items = new object[count];
+                        for (var i = 0; i < count; i++)
+                            items[i] = _ReadValue(data, length, ref pos);
+                        return items;
+                    }
+                case SerializedType.Object:
+                    {
+                        var count = _ReadInt32(data, length, ref pos);
+                        _Require(length, pos, count); // (each property is at least one byte)
+                        var properties = new Dictionary<string, object>(count);
+                        for (var i = 0; i < count; i++)
+                        {
+                            var name = _ReadString(data, length, ref pos);
+                            properties[name] = _ReadValue(data, length, ref pos);
+                        }
+                        return properties;
+                    }
+                default: throw new FormatException("Invalid value type '" + (int)tag + "' found in the serialized data.");
+            }
+        }
+
+        // --------------------------------------------------------------------------------------------------------------------
+
+        [ThreadStatic]
+        static _Writer _CachedWriter; // (reused for each call on the same thread to prevent creating a new buffer each time)
+
+        /// <summary>
+        /// Creates a JavaScript value from the given managed value (and any values it contains) using a single native call.  This
+        /// is much faster than creating objects and setting their properties one at a time.
+        /// </summary>
+        /// <param name="maxDepth"> The maximum nesting depth of objects and arrays. </param>
+        public static InternalHandle CreateValue(V8Engine engine, object value, Int32 maxDepth = DefaultMaxDepth)
+        {
+            if (engine == null) throw new ArgumentNullException(nameof(engine));
+
+            var writer = _CachedWriter ?? new _Writer(DefaultBufferSize);
+            _CachedWriter = null; // (in case a value being written calls back into here)
+
+            try
+            {
+                writer.Reset();
+                writer.WriteValue(value, 0, maxDepth);
+
+                fixed (byte* pData = writer.Buffer)
+                    return _CreateValue(engine, pData, writer.Length, maxDepth);
+            }
+            finally
+            {
+                if (writer.Buffer.Length <= DefaultBufferSize * 16) // (don't hold on to very large buffers)
+                    _CachedWriter = writer;
+            }
+        }
+
+        /// <summary>
+        /// Creates a JavaScript value from serialized data (as returned by 'Serialize()' or 'Write()') using a single native call.
+        /// </summary>
+        public static InternalHandle CreateValue(V8Engine engine, byte[] data, Int32 maxDepth = DefaultMaxDepth)
+        {
+            if (engine == null) throw new ArgumentNullException(nameof(engine));
+            if (data == null) throw new ArgumentNullException(nameof(data));
+
+            fixed (byte* pData = data)
+                return _CreateValue(engine, pData, data.Length, maxDepth);
+        }
+
+        static InternalHandle _CreateValue(V8Engine engine, byte* data, Int32 length, Int32 maxDepth)
+        {
+            InternalHandle handle = V8NetProxy.DeserializeValue(engine._NativeV8EngineProxy, data, length, maxDepth);
+            handle.ThrowOnError();
+            return handle;
+        }
+
+        /// <summary>
+        /// Serializes the given managed value (and any values it contains) and returns the data.
+        /// </summary>
+        /// <param name="maxDepth"> The maximum nesting depth of objects and arrays. </param>
+        public static byte[] Write(object value, Int32 maxDepth = DefaultMaxDepth)
+        {
+            var writer = new _Writer(256);
+            writer.WriteValue(value, 0, maxDepth);
+            var result = new byte[writer.Length];
+            System.Buffer.BlockCopy(writer.Buffer, 0, result, 0, writer.Length);
+            return result;
+        }
+
+        // --------------------------------------------------------------------------------------------------------------------
+
+        sealed class _Writer
+        {
+            public byte[] Buffer;
+            public Int32 Length;
+
+            public _Writer(Int32 capacity) { Buffer = new byte[capacity]; }
+
+            public void Reset() { Length = 0; }
+
+            void _Reserve(Int32 size)
+            {
+                if (Length + size <= Buffer.Length) return;
+                var newCapacity = (long)Buffer.Length * 2;
+                while (newCapacity < (long)Length + size)
+                    newCapacity *= 2;
+                if (newCapacity > Int32.MaxValue)
+                    throw new InvalidOperationException("The serialized data is too large.");
+                Array.Resize(ref Buffer, (Int32)newCapacity);
+            }
+
+            void _Write(SerializedType tag) { _Reserve(1); Buffer[Length++] = (byte)tag; }
+
+            void _Write(SerializedType tag, Int32 value)
+            {
+                _Reserve(1 + sizeof(Int32));
+                Buffer[Length++] = (byte)tag;
+                fixed (byte* p = &Buffer[Length]) *(Int32*)p = value;
+                Length += sizeof(Int32);
+            }
+
+            void _Write(SerializedType tag, double value)
+            {
+                _Reserve(1 + sizeof(double));
+                Buffer[Length++] = (byte)tag;
+                fixed (byte* p = &Buffer[Length]) *(double*)p = value;
+                Length += sizeof(double);
+            }
+
+            void _WriteString(string str)
+            {
+                var size = str.Length * sizeof(char);
+                _Reserve(sizeof(Int32) + size);
+                fixed (byte* p = &Buffer[Length])
+                {
+                    *(Int32*)p = str.Length;
+                    var pChars = (char*)(p + sizeof(Int32));
+                    for (var i = 0; i < str.Length; i++)
+                        pChars[i] = str[i];
+                }
+                Length += sizeof(Int32) + size;
+            }
+
+            // Writes a count placeholder and returns its position (used when the count of an enumeration is not known in advance).
+            Int32 _WriteCount(SerializedType tag)
+            {
+                _Write(tag, 0);
+                return Length - sizeof(Int32);
+            }
+
+            void _UpdateCount(Int32 position, Int32 count)
+            {
+                fixed (byte* p = &Buffer[position]) *(Int32*)p = count;
+            }
+
+            public void WriteValue(object value, Int32 depth, Int32 maxDepth)
+            {
+                if (depth > maxDepth)
+                    throw new InvalidOperationException("The object graph is nested too deeply (or contains a cycle).");
+
+                switch (value)
+                {
+                    case null: _Write(SerializedType.Null); return;
+                    case bool b: _Write(b ? SerializedType.True : SerializedType.False); return;
+                    case Int32 i: _Write(SerializedType.Int32, i); return;
+                    case Int16 i: _Write(SerializedType.Int32, i); return;
+                    case UInt16 i: _Write(SerializedType.Int32, i); return;
+                    case byte i: _Write(SerializedType.Int32, i); return;
+                    case sbyte i: _Write(SerializedType.Int32, i); return;
+                    case UInt32 i: if (i <= Int32.MaxValue) _Write(SerializedType.Int32, (Int32)i); else _Write(SerializedType.Number, i); return;
+                    case Int64 i: if (i >= Int32.MinValue && i <= Int32.MaxValue) _Write(SerializedType.Int32, (Int32)i); else _Write(SerializedType.Number, i); return;
+                    case UInt64 i: if (i <= Int32.MaxValue) _Write(SerializedType.Int32, (Int32)i); else _Write(SerializedType.Number, i); return;
+                    case double n: _Write(SerializedType.Number, n); return;
+                    case float n: _Write(SerializedType.Number, n); return;
+                    case decimal n: _Write(SerializedType.Number, (double)n); return;
+                    case string str: _Write(SerializedType.String); _WriteString(str); return;
+                    case char c: _Write(SerializedType.String); _WriteString(c.ToString()); return;
+                    case DateTime date: _Write(SerializedType.Date, (date.ToUniversalTime() - V8Engine.Epoch).TotalMilliseconds); return;
+                    case IDictionary dictionary:
+                        {
+                            var countPos = _WriteCount(SerializedType.Object);
+                            var count = 0;
+                            foreach (DictionaryEntry entry in dictionary)
+                            {
+                                _WriteString(entry.Key.ToString());
+                                WriteValue(entry.Value, depth + 1, maxDepth);
+                                count++;
+                            }
+                            _UpdateCount(countPos, count);
+                            return;
+                        }
+                    case IEnumerable<KeyValuePair<string, object>> properties:
+                        {
+                            var countPos = _WriteCount(SerializedType.Object);
+                            var count = 0;
+                            foreach (var property in properties)
+                            {
+                                _WriteString(property.Key);
+                                WriteValue(property.Value, depth + 1, maxDepth);
+                                count++;
+                            }
+                            _UpdateCount(countPos, count);
+                            return;
+                        }
+                    case IEnumerable items:
+                        {
+                            var countPos = _WriteCount(SerializedType.Array);
+                            var count = 0;
+                            foreach (var item in items)
+                            {
+                                WriteValue(item, depth + 1, maxDepth);
+                                count++;
+                            }
+                            _UpdateCount(countPos, count);
+                            return;
+                        }
+                    default: throw new NotSupportedException("Values of type '" + value.GetType().FullName + "' cannot be serialized.");
+                }
+            }
+        }
+
+        // --------------------------------------------------------------------------------------------------------------------
+    }
+
+    // ========================================================================================================================
+}
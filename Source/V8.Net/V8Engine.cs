@@ -51,6 +51,40 @@ namespace V8.Net
 
         // --------------------------------------------------------------------------------------------------------------------
 
+        /// <summary>
+        /// Configures the V8 platform shared by all engines in the process, which runs V8's background tasks (compiling, garbage
+        /// collection, etc.) on its own pool of worker threads.  This must be called before the first engine is created; returns
+        /// false if an engine was already created (the options are then ignored).
+        /// </summary>
+        /// <param name="workerCount"> The number of worker threads (0 to use the number of processors less one, up to 8). </param>
+        /// <param name="priority"> The OS priority of the worker threads (only applied on Windows). </param>
+        /// <param name="affinityMask"> The processors the worker threads may run on, one bit per processor (0 for any; only applied on Windows). </param>
+        public static bool ConfigurePlatform(Int32 workerCount, ThreadPriority priority = ThreadPriority.Normal, UInt64 affinityMask = 0)
+        {
+            if (workerCount < 0) throw new ArgumentOutOfRangeException(nameof(workerCount));
+
+            var options = new PlatformOptions
+            {
+                WorkerCount = workerCount,
+                ThreadPriority = (Int32)priority - (Int32)ThreadPriority.Normal, // (these map to the Windows 'THREAD_PRIORITY_LOWEST' ... 'THREAD_PRIORITY_HIGHEST' values)
+                AffinityMask = affinityMask
+            };
+
+            return V8NetProxy.ConfigurePlatform(&options);
+        }
+
+        /// <summary>
+        /// Returns the task statistics for the V8 platform shared by all engines in the process.
+        /// </summary>
+        public static PlatformStats GetPlatformStats()
+        {
+            PlatformStats stats;
+            V8NetProxy.GetPlatformStats(&stats);
+            return stats;
+        }
+
+        // --------------------------------------------------------------------------------------------------------------------
+
         /// <summary>
         /// A static array of all V8 engines created.
         /// </summary>
@@ -242,13 +276,23 @@ namespace V8.Net
         ///     (Optional) True to automatically create a global context. If this is false then you must construct a context
         ///     yourself before executing JavaScript or calling methods that require contexts.
         /// </param>
-        public V8Engine(bool autoCreateGlobalContext = true)
+        public V8Engine(bool autoCreateGlobalContext = true) : this(autoCreateGlobalContext, V8EngineFlags.None) { }
+
+        /// <summary> V8Engine constructor. </summary>
+        /// <param name="autoCreateGlobalContext">
+        ///     True to automatically create a global context. If this is false then you must construct a context yourself before
+        ///     executing JavaScript or calling methods that require contexts.
+        /// </param>
+        /// <param name="flags"> Options for the native engine (see <see cref="V8EngineFlags"/>). </param>
+        public V8Engine(bool autoCreateGlobalContext, V8EngineFlags flags)
         {
             RunMarshallingTests();
 
+            Flags = flags;
+
             lock (_GlobalLock) // (required because engine proxy instance IDs are tracked on the native side in a static '_DisposedEngines' vector [for quick disposal of handles])
             {
-                _NativeV8EngineProxy = V8NetProxy.CreateV8EngineProxy(false, null, 0);
+                _NativeV8EngineProxy = V8NetProxy.CreateV8EngineProxyEx(false, null, 0, flags);
 
                 _RegisterEngine(_NativeV8EngineProxy->ID);
 
@@ -271,7 +315,8 @@ namespace V8.Net
 
         ~V8Engine()
         {
-            Dispose();
+            if ((Flags & V8EngineFlags.ThreadAffine) == 0) // (thread-affine engines can only be destroyed by the thread that owns them, and this is the GC thread)
+                Dispose();
         }
 
         public void Dispose()
@@ -323,6 +368,11 @@ namespace V8.Net
             }
         }
 
+        /// <summary>
+        /// The options this engine was created with.
+        /// </summary>
+        public V8EngineFlags Flags { get; }
+
         /// <summary>
         /// Returns true once this engine has been disposed.
         /// </summary>
@@ -542,6 +592,33 @@ namespace V8.Net
             V8NetProxy.TerminateExecution(_NativeV8EngineProxy);
         }
 
+        /// <summary>
+        /// Returns the counters for the native argument buffers used by function callbacks, 'Call()', and creating instances from
+        /// function templates.  Useful to confirm (in benchmarks) that calls are not allocating memory.
+        /// </summary>
+        public ArgumentBufferStats GetArgumentBufferStats()
+        {
+            V8NetProxy.GetArgumentBufferStats(_NativeV8EngineProxy, out var stats);
+            return stats;
+        }
+
+        /// <summary>
+        /// Keeps the native isolate locked and its scopes entered across the following calls into this engine from the calling
+        /// thread, until the returned session is disposed.  This saves the locking and scope setup done by each native call when
+        /// many calls are made in a row (such as creating an object and setting many properties).  Sessions can be nested.
+        /// <para>If another thread has a session open on this engine, this waits until that session ends.  See
+        /// <see cref="V8EngineSession"/> for details.</para>
+        /// <para>Note: Sessions on a thread-affine engine (see <see cref="V8EngineFlags.ThreadAffine"/>) can only be opened by the
+        /// thread that created the engine.</para>
+        /// </summary>
+        public V8EngineSession BeginSession()
+        {
+            var depth = V8NetProxy.BeginSession(_NativeV8EngineProxy);
+            if (depth < 0)
+                throw new InvalidOperationException("A session on a thread-affine engine can only be opened by the thread that created the engine.");
+            return new V8EngineSession(this, depth);
+        }
+
         /// <summary>
         /// Loads a JavaScript file from the current working directory (or specified absolute path) and executes it in the V8 engine, then returns the result.
         /// </summary>
@@ -594,6 +671,46 @@ namespace V8.Net
             }
             return result.KeepTrack();
         }
+
+        /// <summary>
+        /// Parses JSON text using the native V8 JSON parser (the same as 'JSON.parse()' in script, but without executing any
+        /// script).  If the text is not valid JSON, the returned handle is an execution error (see 'InternalHandle.IsError').
+        /// </summary>
+        /// <param name="throwExceptionOnError"> (Optional) If true, and the text is not valid JSON, an exception is thrown (default is 'false'). </param>
+        public InternalHandle ParseJSON(string json, bool throwExceptionOnError = false)
+        {
+            if (json == null) throw new ArgumentNullException(nameof(json));
+
+            InternalHandle result;
+            fixed (char* pJson = json)
+                result = V8NetProxy.ParseJSON(_NativeV8EngineProxy, pJson, json.Length);
+
+            if (throwExceptionOnError)
+                result.ThrowOnError();
+
+            return result;
+        }
+
+        /// <summary>
+        /// Parses UTF-8 encoded JSON text using the native V8 JSON parser, without decoding it into a managed string first.
+        /// If the text is not valid JSON, the returned handle is an execution error (see 'InternalHandle.IsError').
+        /// </summary>
+        /// <param name="throwExceptionOnError"> (Optional) If true, and the text is not valid JSON, an exception is thrown (default is 'false'). </param>
+        public InternalHandle ParseJSON(byte[] utf8Json, Int32 index, Int32 count, bool throwExceptionOnError = false)
+        {
+            if (utf8Json == null) throw new ArgumentNullException(nameof(utf8Json));
+            if (index < 0 || count < 0 || index + count > utf8Json.Length) throw new ArgumentOutOfRangeException(nameof(count));
+
+            InternalHandle result;
+            fixed (byte* pJson = utf8Json)
+                result = V8NetProxy.ParseJSONUtf8(_NativeV8EngineProxy, pJson + index, count);
+
+            if (throwExceptionOnError)
+                result.ThrowOnError();
+
+            return result;
+        }
+
         // --------------------------------------------------------------------------------------------------------------------
 
         /// <summary>
@@ -832,6 +949,255 @@ namespace V8.Net
             return handle;
         }
 
+        // --------------------------------------------------------------------------------------------------------------------
+
+        static readonly Dictionary<Int32, Action<IntPtr, Int64>> _ArrayBufferReleaseActions = new Dictionary<Int32, Action<IntPtr, Int64>>();
+        static Int32 _NextArrayBufferReleaseID;
+        static readonly NativeReleaseCallback _ArrayBufferReleaseCallback = _OnArrayBufferReleased; // (must be kept alive while the native side references it)
+
+        static void _OnArrayBufferReleased(void* data, Int64 length, Int32 releaseID)
+        {
+            Action<IntPtr, Int64> release;
+            lock (_ArrayBufferReleaseActions)
+            {
+                if (!_ArrayBufferReleaseActions.TryGetValue(releaseID, out release)) return;
+                _ArrayBufferReleaseActions.Remove(releaseID);
+            }
+            release((IntPtr)data, length);
+        }
+
+        /// <summary>
+        /// Creates a JavaScript ArrayBuffer over the given memory without copying it.  The memory must remain valid (and must not
+        /// move) until 'release' is called, which happens once V8 no longer references the buffer, or when the engine is disposed.
+        /// <para>Note: 'release' may be called during a V8 garbage collection, so it must not access the engine.  If the buffer
+        /// cannot be created, an error handle is returned and 'release' is called before returning.</para>
+        /// </summary>
+        public InternalHandle CreateArrayBuffer(IntPtr data, Int64 length, Action<IntPtr, Int64> release)
+        {
+            Int32 releaseID = 0;
+
+            if (release != null)
+                lock (_ArrayBufferReleaseActions)
+                {
+                    releaseID = ++_NextArrayBufferReleaseID;
+                    _ArrayBufferReleaseActions[releaseID] = release;
+                }
+
+            InternalHandle handle = V8NetProxy.CreateExternalArrayBuffer(_NativeV8EngineProxy, (void*)data, length, release != null ? _ArrayBufferReleaseCallback : null, releaseID);
+
+            if (handle.IsError && release != null)
+            {
+                bool removed;
+                lock (_ArrayBufferReleaseActions)
+                    removed = _ArrayBufferReleaseActions.Remove(releaseID);
+                if (removed)
+                    release(data, length); // (V8 never took the memory, so the caller's cleanup must still run [i.e. to unpin managed arrays])
+            }
+
+            return handle;
+        }
+
+        /// <summary>
+        /// Creates a JavaScript ArrayBuffer that shares the memory of the given byte array (no copy is made, so changes made on
+        /// either side are seen by the other).  The array stays pinned until V8 no longer references the buffer.
+        /// </summary>
+        public InternalHandle CreateArrayBuffer(byte[] data)
+        {
+            if (data == null) throw new ArgumentNullException(nameof(data));
+            var pin = GCHandle.Alloc(data, GCHandleType.Pinned);
+            try
+            {
+                return CreateArrayBuffer(pin.AddrOfPinnedObject(), data.Length, (ptr, length) => pin.Free());
+            }
+            catch
+            {
+                if (pin.IsAllocated) pin.Free();
+                throw;
+            }
+        }
+
+        /// <summary>
+        /// Creates a typed array (or DataView) over an ArrayBuffer, or over the buffer of an existing typed array or DataView (the
+        /// byte offset is then relative to that view, and the new view must fit within it).
+        /// </summary>
+        /// <param name="buffer"> The ArrayBuffer (or view) to create the view over. </param>
+        /// <param name="type"> The element type of the view. </param>
+        /// <param name="byteOffset"> The offset into the buffer in bytes (must be a multiple of the element size). </param>
+        /// <param name="length"> The number of elements (bytes for a DataView), or -1 to use the rest of the buffer (or view). </param>
+        public InternalHandle CreateTypedArray(InternalHandle buffer, TypedArrayType type, Int64 byteOffset = 0, Int64 length = -1)
+        {
+            if (buffer.IsEmpty) throw new ArgumentNullException(nameof(buffer));
+            InternalHandle handle = V8NetProxy.CreateTypedArray(buffer, type, byteOffset, length);
+            handle.ThrowOnError();
+            return handle;
+        }
+
+        /// <summary>
+        /// Creates a dataset object that exposes columnar data to scripts without creating an object per row.  The object has a
+        /// 'length' (the row count), 'columns' (a typed array over each column's values; no copy is made), 'dictionaries' (the
+        /// distinct strings of each string column), and 'rows' (a lazy row view, where 'rows[i]' returns an object that reads the
+        /// column values for row 'i' on demand).
+        /// <para>The column arrays stay pinned until V8 no longer references the dataset or any of its columns.</para>
+        /// </summary>
+        public InternalHandle CreateDataset(params DatasetColumn[] columns)
+        {
+            if (columns == null) throw new ArgumentNullException(nameof(columns));
+
+            var rowCount = columns.Length > 0 ? columns[0].Length : 0;
+            foreach (var column in columns)
+                if (column.Length != rowCount) throw new ArgumentException("All columns must have the same number of rows.", nameof(columns));
+
+            var dataPins = new GCHandle[columns.Length];
+            var stringPins = new List<GCHandle>(); // (names and dictionary strings are copied by the native side, so only pinned for the call)
+            var infos = new DatasetColumnInfo[columns.Length];
+            Int32 releaseID = 0;
+            var created = false;
+
+            try
+            {
+                for (var i = 0; i < columns.Length; i++)
+                {
+                    var column = columns[i];
+
+                    dataPins[i] = GCHandle.Alloc(column.Data, GCHandleType.Pinned);
+                    infos[i].Data = (void*)dataPins[i].AddrOfPinnedObject();
+                    infos[i].Type = column.Type;
+
+                    var namePin = GCHandle.Alloc(column.Name, GCHandleType.Pinned);
+                    stringPins.Add(namePin);
+                    infos[i].Name = (char*)namePin.AddrOfPinnedObject();
+
+                    if (column.Dictionary != null)
+                    {
+                        var strings = new IntPtr[column.Dictionary.Length];
+                        for (var s = 0; s < strings.Length; s++)
+                            if (column.Dictionary[s] != null)
+                            {
+                                var pin = GCHandle.Alloc(column.Dictionary[s], GCHandleType.Pinned);
+                                stringPins.Add(pin);
+                                strings[s] = pin.AddrOfPinnedObject();
+                            }
+                        var stringsPin = GCHandle.Alloc(strings, GCHandleType.Pinned);
+                        stringPins.Add(stringsPin);
+                        infos[i].Dictionary = (char**)stringsPin.AddrOfPinnedObject();
+                        infos[i].DictionarySize = strings.Length;
+                    }
+                }
+
+                lock (_ArrayBufferReleaseActions)
+                {
+                    releaseID = ++_NextArrayBufferReleaseID;
+                    _ArrayBufferReleaseActions[releaseID] = (ptr, length) => { foreach (var pin in dataPins) pin.Free(); };
+                }
+
+                InternalHandle handle;
+                fixed (DatasetColumnInfo* pInfos = infos)
+                    handle = V8NetProxy.CreateDataset(_NativeV8EngineProxy, rowCount, pInfos, columns.Length, _ArrayBufferReleaseCallback, releaseID);
+
+                handle.ThrowOnError();
+                created = true; // (the data pins are now freed when the native side releases the dataset)
+
+                return handle;
+            }
+            finally
+            {
+                foreach (var pin in stringPins)
+                    pin.Free();
+
+                if (!created)
+                {
+                    if (releaseID != 0)
+                        lock (_ArrayBufferReleaseActions)
+                            _ArrayBufferReleaseActions.Remove(releaseID);
+                    foreach (var pin in dataPins)
+                        if (pin.IsAllocated) pin.Free();
+                }
+            }
+        }
+
+        /// <summary>
+        /// Invalidates the property values cached for all objects created from object templates (see 'IV8CacheableProperties').
+        /// This is a constant time operation; each cache is cleared the next time it is used.
+        /// </summary>
+        public void InvalidatePropertyCaches()
+        {
+            V8NetProxy.InvalidateAllPropertyCaches(_NativeV8EngineProxy);
+        }
+
+        /// <summary>
+        /// Registers an object shape (an ordered list of property names and their expected types) for reading and creating
+        /// objects with a single native call (see 'ObjectShape').
+        /// </summary>
+        public ObjectShape RegisterShape(string[] names, ShapeFieldType[] types)
+        {
+            if (names == null) throw new ArgumentNullException(nameof(names));
+            if (types == null) throw new ArgumentNullException(nameof(types));
+            if (names.Length != types.Length) throw new ArgumentException("There must be one type per name.", nameof(types));
+
+            var pins = new GCHandle[names.Length];
+            var namePtrs = new IntPtr[names.Length];
+
+            try
+            {
+                for (var i = 0; i < names.Length; i++)
+                {
+                    if (names[i] == null) throw new ArgumentNullException(nameof(names) + "[" + i + "]");
+                    pins[i] = GCHandle.Alloc(names[i], GCHandleType.Pinned);
+                    namePtrs[i] = pins[i].AddrOfPinnedObject();
+                }
+
+                Int32 id;
+
+                fixed (IntPtr* pNames = namePtrs)
+                fixed (ShapeFieldType* pTypes = types)
+                    id = V8NetProxy.RegisterShape(_NativeV8EngineProxy, (char**)pNames, pTypes, names.Length);
+
+                return new ObjectShape(this, id, (string[])names.Clone(), (ShapeFieldType[])types.Clone());
+            }
+            finally
+            {
+                foreach (var pin in pins)
+                    if (pin.IsAllocated) pin.Free();
+            }
+        }
+
+        /// <summary>
+        /// Registers a property name for use in command buffers and returns its ID (see 'CommandBuffer').  The name is converted
+        /// to a JavaScript string once and kept for the life of the engine, so names should be registered once and reused.
+        /// </summary>
+        public Int32 RegisterCommandName(string name)
+        {
+            if (name == null) throw new ArgumentNullException(nameof(name));
+            return V8NetProxy.RegisterCommandName(_NativeV8EngineProxy, name);
+        }
+
+        /// <summary>
+        /// Sets the limits for the array buffer memory of this engine.
+        /// </summary>
+        /// <param name="maxBytes">
+        ///     The maximum bytes scripts can allocate for array buffers at one time (0 for no limit).  Once reached, creating more
+        ///     buffers throws a 'RangeError' in the script.  Buffers created over external memory don't count towards this limit.
+        /// </param>
+        /// <param name="maxPooledBytes">
+        ///     The maximum bytes of freed small buffers to keep for reuse (default is 4 MB; 0 disables pooling).
+        /// </param>
+        public void SetArrayBufferLimits(Int64 maxBytes, Int64 maxPooledBytes = 4 * 1024 * 1024)
+        {
+            V8NetProxy.SetArrayBufferLimits(_NativeV8EngineProxy, maxBytes, maxPooledBytes);
+        }
+
+        /// <summary>
+        /// Returns the allocation statistics for the array buffer memory of this engine.
+        /// </summary>
+        public ArrayBufferAllocatorStats GetArrayBufferAllocatorStats()
+        {
+            ArrayBufferAllocatorStats stats;
+            V8NetProxy.GetArrayBufferAllocatorStats(_NativeV8EngineProxy, &stats);
+            return stats;
+        }
+
+        // --------------------------------------------------------------------------------------------------------------------
+
         /// <summary>
         /// Converts an enumeration of values (usually from a collection, list, or array) into a JavaScript array.
         /// By default, an exception will occur if any type cannot be converted.
@@ -880,37 +1246,65 @@ namespace V8.Net
             if (_items == null || _items.Length == 0) return V8NetProxy.CreateArray(_NativeV8EngineProxy, null, 0);
 
             int strBufSize = 0; // (size needed for the string chars portion of the memory block)
-            int itemsCount = 0;
+            int itemsCount = _items.Length;
 
-            for (int i = 0, n = _items.Length; i < n; ++i)
-            {
-                // get length of all strings together
-                strBufSize += _items[i].Length + 1; // (+1 for null char)
-                itemsCount++;
-            }
+            for (int i = 0; i < itemsCount; ++i)
+                strBufSize += _items[i]?.Length ?? 0; // (get length of all strings together; the lengths are passed, so no null chars are needed)
 
-            int strPtrBufSize = Marshal.SizeOf(typeof(IntPtr)) * itemsCount; // start buffer size with size needed for all string pointers.
-            char** oneBigStringBlock = (char**)Utilities.AllocNativeMemory(strPtrBufSize + Marshal.SystemDefaultCharSize * strBufSize);
-            char** ptrWritePtr = oneBigStringBlock;
-            char* strWritePtr = (char*)(((byte*)oneBigStringBlock) + strPtrBufSize);
-            int itemLength;
+            // ... the memory block holds the string pointers, then the string lengths, then the characters of all the strings ...
 
-            for (int i = 0, n = _items.Length; i < n; ++i)
+            int strPtrBufSize = sizeof(char*) * itemsCount;
+            int lengthsBufSize = sizeof(Int32) * itemsCount;
+            byte* oneBigStringBlock = (byte*)Utilities.AllocNativeMemory(strPtrBufSize + lengthsBufSize + sizeof(char) * strBufSize);
+            char** ptrWritePtr = (char**)oneBigStringBlock;
+            Int32* lengths = (Int32*)(oneBigStringBlock + strPtrBufSize);
+            char* strWritePtr = (char*)(oneBigStringBlock + strPtrBufSize + lengthsBufSize);
+
+            for (int i = 0; i < itemsCount; ++i)
             {
-                itemLength = _items[i].Length;
-                Marshal.Copy(_items[i].ToCharArray(), 0, (IntPtr)strWritePtr, itemLength);
-                Marshal.WriteInt16((IntPtr)(strWritePtr + itemLength), 0);
-                Marshal.WriteIntPtr((IntPtr)ptrWritePtr++, (IntPtr)strWritePtr);
-                strWritePtr += itemLength + 1;
+                var item = _items[i];
+                if (item == null)
+                {
+                    ptrWritePtr[i] = null; // (null strings become null values)
+                    lengths[i] = 0;
+                    continue;
+                }
+                for (var j = 0; j < item.Length; j++)
+                    strWritePtr[j] = item[j];
+                ptrWritePtr[i] = strWritePtr;
+                lengths[i] = item.Length;
+                strWritePtr += item.Length;
             }
 
-            InternalHandle handle = V8NetProxy.CreateStringArray(_NativeV8EngineProxy, oneBigStringBlock, itemsCount);
+            InternalHandle handle = V8NetProxy.CreateArrayOfStrings(_NativeV8EngineProxy, (char**)oneBigStringBlock, lengths, itemsCount);
 
             Utilities.FreeNativeMemory((IntPtr)oneBigStringBlock);
 
             return handle;
         }
 
+        /// <summary>
+        /// Creates a JavaScript array of numbers in a single native call (the array is created with all the values at once, which is
+        /// much faster than setting each element).
+        /// </summary>
+        public InternalHandle CreateValue(double[] values)
+        {
+            if (values == null) throw new ArgumentNullException(nameof(values));
+            fixed (double* pValues = values)
+                return V8NetProxy.CreateArrayOfNumbers(_NativeV8EngineProxy, pValues, values.Length);
+        }
+
+        /// <summary>
+        /// Creates a JavaScript array of integers in a single native call (the array is created with all the values at once, which is
+        /// much faster than setting each element).
+        /// </summary>
+        public InternalHandle CreateValue(Int32[] values)
+        {
+            if (values == null) throw new ArgumentNullException(nameof(values));
+            fixed (Int32* pValues = values)
+                return V8NetProxy.CreateArrayOfIntegers(_NativeV8EngineProxy, pValues, values.Length);
+        }
+
         // --------------------------------------------------------------------------------------------------------------------
 
         /// <summary>
@@ -1605,6 +1605,7 @@ namespace V8.Net
                         handle.SetProperty("$__Type", Engine.CreateValue(BoundType.AssemblyQualifiedName), V8PropertyAttributes.Locked);
                         handle.SetProperty("$__TypeID", Engine.CreateValue(TypeID), V8PropertyAttributes.Locked);
                         handle.SetProperty("$__Value", args.Length > 0 ? args[0] : InternalHandle.Empty, V8PropertyAttributes.DontDelete);
+                        V8NetProxy.SetObjectCLRTypeID(handle, TypeID); // (tags the object natively so the type ID can be detected without property lookups)
                     }
                     catch (Exception ex)
                     {
@@ -135,6 +135,10 @@ namespace V8.Net
                 if ((Int32)hp->Disposed != _GetMarshalTestInt32Value(ofs, out data)) _ThrowMarshalTestError("HandleProxy", "Disposed", ofs, data, (byte*)&hp->Disposed); // (0 = in use, 1 = managed side ready to dispose, 2 = object is weak (if applicable), 3 = disposed/cached)
                 ofs = (byte)((int)&hp->EngineID - (int)hp);
                 if ((Int32)hp->EngineID != _GetMarshalTestInt32Value(ofs, out data)) _ThrowMarshalTestError("HandleProxy", "EngineID", ofs, data, (byte*)&hp->EngineID);
+                ofs = (byte)((int)&hp->ValueIsCurrent - (int)hp);
+                if ((Int32)hp->ValueIsCurrent != _GetMarshalTestInt32Value(ofs, out data)) _ThrowMarshalTestError("HandleProxy", "ValueIsCurrent", ofs, data, (byte*)&hp->ValueIsCurrent);
+                ofs = (byte)((int)&hp->Generation - (int)hp);
+                if ((Int32)hp->Generation != _GetMarshalTestInt32Value(ofs, out data)) _ThrowMarshalTestError("HandleProxy", "Generation", ofs, data, (byte*)&hp->Generation);
                 ofs = (byte)((int)&hp->NativeEngineProxy - (int)hp);
                 if ((Int64)hp->NativeEngineProxy != _GetMarshalTestPTRValue(ofs, out data)) _ThrowMarshalTestError("HandleProxy", "NativeEngineProxy", ofs, data, (byte*)&hp->NativeEngineProxy); // Pointer to the native V8 engine proxy object associated with this proxy handle instance (used native side to free the handle upon destruction).
                 ofs = (byte)((int)&hp->NativeV8Handle - (int)hp);
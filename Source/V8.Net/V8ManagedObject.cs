@@ -103,6 +103,20 @@ namespace V8.Net
         // --------------------------------------------------------------------------------------------------------------------
     }
 
+    /// <summary>
+    /// Implement this on a managed object (see 'IV8ManagedObject') to let the native side cache property values returned by
+    /// 'NamedPropertyGetter()', so repeated reads of the same property from scripts never call back into managed code.
+    /// <para>A cached value is kept until the property is set or deleted by a script, or until it is invalidated using
+    /// 'InternalHandle.InvalidatePropertyCache()' (one object) or 'V8Engine.InvalidatePropertyCaches()' (all objects).</para>
+    /// </summary>
+    public interface IV8CacheableProperties
+    {
+        /// <summary>
+        /// Returns true if the value just returned for the given property can be cached until invalidated.
+        /// </summary>
+        bool IsPropertyCacheable(string propertyName, InternalHandle value);
+    }
+
     /// <summary>
     /// Represents a C# (managed) JavaScript object.  Properties are set on the object within the class itself, and not within V8.
     /// This is done by using V8 object interceptors (callbacks).  By default, this object is used for the global environment.
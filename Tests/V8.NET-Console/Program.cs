@@ -373,6 +373,293 @@ namespace V8.Net
                                         a_ = _V8Engine.DynamicGlobalObject.a[2];
                                         Debug.Assert(((InternalHandle)a_).AsString == "3", "((InternalHandle)_V8Engine.DynamicGlobalObject.a[2]).AsString != \"3\"");
                                         Console.WriteLine("* Dynamic test 4: " + ((InternalHandle)a_).AsString); // (test dynamic non-member invoke)
+
+                                        Console.WriteLine("Dataset Tests: ");
+
+                                        // ... wrapping a dataset row as a managed object must not drop the reference that keeps the dataset alive ...
+
+                                        V8NativeObject row;
+                                        using (var dataset = _V8Engine.CreateDataset(DatasetColumn.FromIntegers("id", new[] { 10, 20, 30 })))
+                                        using (var rows = dataset.GetProperty("rows"))
+                                        using (var rowHandle = rows.GetProperty(1))
+                                            row = _V8Engine.GetObject(rowHandle);
+
+                                        _V8Engine.ForceV8GarbageCollection(); // (only the wrapped row references the dataset now)
+
+                                        using (var id = row.GetProperty("id"))
+                                        {
+                                            if (!id.IsInt32 || id.AsInt32 != 20)
+                                                throw new Exception("The dataset row returned the wrong value after being wrapped as a managed object.");
+                                            Console.WriteLine("* Dataset test 1: " + id.AsInt32);
+                                        }
+
+                                        void expectException<TException>(Action action, string message) where TException : Exception
+                                        {
+                                            try { action(); }
+                                            catch (TException) { return; }
+                                            throw new Exception(message);
+                                        }
+
+                                        Console.WriteLine("Serializer Tests: ");
+
+                                        // ... the values read through the binary serializer must match what the script created ...
+
+                                        using (var value = _V8Engine.Execute("({ id: 1, name: 'a', price: 2.5, active: true, created: new Date(0), tags: ['x', 'y'], child: { none: null } })", throwExceptionOnError: true))
+                                        {
+                                            var graph = (Dictionary<string, object>)ObjectSerializer.Read(value);
+                                            var tags = (object[])graph["tags"];
+                                            if (!(graph["id"] is Int32 graphID && graphID == 1) || (string)graph["name"] != "a" || (double)graph["price"] != 2.5 || !(bool)graph["active"]
+                                                || (DateTime)graph["created"] != V8Engine.Epoch || tags.Length != 2 || (string)tags[0] != "x" || (string)tags[1] != "y"
+                                                || ((Dictionary<string, object>)graph["child"])["none"] != null)
+                                                throw new Exception("The serializer did not read back the values the script created.");
+
+                                            var data = ObjectSerializer.Serialize(value);
+                                            if (!ObjectSerializer.Write(ObjectSerializer.Deserialize(data)).SequenceEqual(data))
+                                                throw new Exception("The serialized data did not round-trip through 'Deserialize()' and 'Write()'.");
+                                            Console.WriteLine("* Serializer test 1: " + data.Length + " bytes");
+                                        }
+
+                                        // ... cycles and the depth and size limits must fail cleanly; a shared (but not cyclic) object is fine ...
+
+                                        using (var cyclic = _V8Engine.Execute("var cyclic = { a: {} }; cyclic.a.parent = cyclic; cyclic", throwExceptionOnError: true))
+                                            expectException<InvalidOperationException>(() => ObjectSerializer.Read(cyclic), "The serializer did not detect a cycle.");
+
+                                        using (var shared = _V8Engine.Execute("var shared = {}; ({ a: shared, b: shared })", throwExceptionOnError: true))
+                                            if (((Dictionary<string, object>)ObjectSerializer.Read(shared)).Count != 2)
+                                                throw new Exception("The serializer failed to read an object referenced twice.");
+
+                                        using (var nested = _V8Engine.Execute("[[[[1]]]]", throwExceptionOnError: true))
+                                        {
+                                            expectException<InvalidOperationException>(() => ObjectSerializer.Read(nested, maxDepth: 2), "The serializer did not enforce the maximum depth.");
+                                            if (!(ObjectSerializer.Read(nested, maxDepth: 4) is object[]))
+                                                throw new Exception("The serializer failed on a value within the maximum depth.");
+                                        }
+
+                                        using (var text = _V8Engine.CreateValue(new string('x', 1000)))
+                                        {
+                                            expectException<InvalidOperationException>(() => ObjectSerializer.Serialize(text, maxSize: 100), "The serializer did not enforce the maximum size.");
+                                            if (ObjectSerializer.Serialize(text, maxSize: 4096).Length <= 2000)
+                                                throw new Exception("The serializer returned less data than expected.");
+                                        }
+                                        Console.WriteLine("* Serializer test 2: cycles and limits are enforced");
+
+                                        Console.WriteLine("Deserializer Tests: ");
+
+                                        // ... an object graph created in one call must have the values (and types) of the managed graph ...
+
+                                        var source = new Dictionary<string, object>
+                                        {
+                                            { "id", 7 },
+                                            { "name", "b" },
+                                            { "items", new object[] { 1, 2.5, null, true } },
+                                            { "when", V8Engine.Epoch.AddMilliseconds(1000) }
+                                        };
+
+                                        using (var created = ObjectSerializer.CreateValue(_V8Engine, source))
+                                        {
+                                            _V8Engine.GlobalObject.SetProperty("created", created);
+                                            using (var check = _V8Engine.Execute("created.id === 7 && created.name === 'b' && created.items.length === 4 && created.items[1] === 2.5"
+                                                + " && created.items[2] === null && created.items[3] === true && created.when.getTime() === 1000", throwExceptionOnError: true))
+                                                if (!check.AsBoolean)
+                                                    throw new Exception("The deserializer did not create the values of the managed graph.");
+
+                                            if (!ObjectSerializer.Serialize(created).SequenceEqual(ObjectSerializer.Write(source)))
+                                                throw new Exception("The created value did not serialize back to the data it was created from.");
+                                            Console.WriteLine("* Deserializer test 1: " + created.ToJSON());
+                                        }
+
+                                        // ... cyclic managed input, data nested deeper than the limit, and truncated data must fail cleanly ...
+
+                                        var loop = new Dictionary<string, object>();
+                                        loop["self"] = loop;
+                                        expectException<InvalidOperationException>(() => ObjectSerializer.CreateValue(_V8Engine, loop), "Creating a value from a cyclic managed graph did not fail.");
+
+                                        var deep = ObjectSerializer.Write(new object[] { new object[] { new object[] { 1 } } });
+                                        expectException<V8Exception>(() => ObjectSerializer.CreateValue(_V8Engine, deep, maxDepth: 1), "The deserializer did not enforce the maximum depth.");
+                                        using (var deepValue = ObjectSerializer.CreateValue(_V8Engine, deep, maxDepth: 3))
+                                            if (!deepValue.IsArray)
+                                                throw new Exception("The deserializer failed on data within the maximum depth.");
+
+                                        expectException<V8Exception>(() => ObjectSerializer.CreateValue(_V8Engine, deep.Take(deep.Length - 2).ToArray()), "The deserializer accepted truncated data.");
+                                        Console.WriteLine("* Deserializer test 2: cycles, limits, and invalid data are rejected");
+
+                                        Console.WriteLine("JSON Tests: ");
+
+                                        // ... text parsed natively must stringify back to the same text, whichever way it is read or written ...
+
+                                        var json = "{\"a\":[1,2.5,{\"b\":\"c\u00e9\"}],\"d\":null,\"e\":true}";
+
+                                        using (var parsed = _V8Engine.ParseJSON(json, true))
+                                        {
+                                            if (parsed.ToJSON() != json)
+                                                throw new Exception("'ToJSON()' did not return the text that was parsed.");
+
+                                            var writer = new StringWriter();
+                                            parsed.WriteJSON(writer);
+                                            if (writer.ToString() != json)
+                                                throw new Exception("'WriteJSON(TextWriter)' did not write the text that was parsed.");
+
+                                            var stream = new MemoryStream();
+                                            parsed.WriteJSON(stream);
+                                            if (!stream.ToArray().SequenceEqual(Encoding.UTF8.GetBytes(json)))
+                                                throw new Exception("'WriteJSON(Stream)' did not write the UTF-8 text that was parsed.");
+                                        }
+
+                                        var utf8Json = Encoding.UTF8.GetBytes(json);
+                                        using (var parsed = _V8Engine.ParseJSON(utf8Json, 0, utf8Json.Length, true))
+                                            if (parsed.ToJSON() != json)
+                                                throw new Exception("UTF-8 text was not parsed the same as the string text.");
+
+                                        using (var parsed = _V8Engine.ParseJSON("{\"a\":1}", true))
+                                            if (parsed.ToJSON("  ") != "{\n  \"a\": 1\n}")
+                                                throw new Exception("'ToJSON()' did not indent the text using the given gap.");
+
+                                        using (var longText = _V8Engine.CreateValue(new string('x', 5000))) // (larger than the stack buffer used by 'ToJSON()')
+                                            if (longText.ToJSON() != "\"" + new string('x', 5000) + "\"")
+                                                throw new Exception("'ToJSON()' did not return the whole text of a long value.");
+                                        Console.WriteLine("* JSON test 1: " + json);
+
+                                        // ... invalid text and cyclic values must be reported as errors ...
+
+                                        using (var invalid = _V8Engine.ParseJSON("{"))
+                                            if (!invalid.IsError)
+                                                throw new Exception("Invalid JSON text did not return an error.");
+                                        expectException<V8Exception>(() => _V8Engine.ParseJSON("{", true), "Invalid JSON text did not throw an exception.");
+
+                                        using (var cyclic = _V8Engine.Execute("var cyclicJSON = {}; cyclicJSON.self = cyclicJSON; cyclicJSON", throwExceptionOnError: true))
+                                            expectException<V8Exception>(() => cyclic.ToJSON(), "Stringifying a cyclic value did not throw an exception.");
+                                        Console.WriteLine("* JSON test 2: invalid text and cycles are rejected");
+
+                                        Console.WriteLine("Object Shape Tests: ");
+
+                                        // ... one registered shape must read, and create, any number of objects ...
+
+                                        var shape = _V8Engine.RegisterShape(new[] { "id", "name", "price", "when" },
+                                            new[] { ShapeFieldType.Int32, ShapeFieldType.String, ShapeFieldType.Number, ShapeFieldType.Date });
+
+                                        for (var i = 0; i < 3; i++)
+                                            using (var item = _V8Engine.Execute("({ id: " + i + ", name: 'item" + i + "', price: " + i + ".5, when: new Date(" + i * 1000 + ") })", throwExceptionOnError: true))
+                                            {
+                                                var values = shape.Extract(item);
+                                                if ((Int32)values[0] != i || (string)values[1] != "item" + i || (double)values[2] != i + 0.5 || (DateTime)values[3] != V8Engine.Epoch.AddMilliseconds(i * 1000))
+                                                    throw new Exception("The shape did not read the values of object " + i + ".");
+                                            }
+
+                                        for (var i = 0; i < 3; i++)
+                                            using (var item = shape.Create(10 + i, "made" + i, i + 0.25, V8Engine.Epoch.AddMilliseconds(i)))
+                                            {
+                                                _V8Engine.GlobalObject.SetProperty("shapedItem", item);
+                                                using (var check = _V8Engine.Execute("shapedItem.id === " + (10 + i) + " && shapedItem.name === 'made" + i + "' && shapedItem.price === " + i + ".25"
+                                                    + " && shapedItem.when.getTime() === " + i, throwExceptionOnError: true))
+                                                    if (!check.AsBoolean)
+                                                        throw new Exception("The shape did not create object " + i + " with the given values.");
+                                            }
+                                        Console.WriteLine("* Object shape test 1: read and created 3 objects each with one shape");
+
+                                        // ... properties that don't have the expected type (or are missing) must not be read as valid values ...
+
+                                        using (var item = _V8Engine.Execute("({ id: 'x', name: 5 })", throwExceptionOnError: true))
+                                        {
+                                            var values = shape.Extract(item);
+                                            if ((Int32)values[0] != 0 || values[1] != null || values[2] != null || values[3] != null)
+                                                throw new Exception("The shape read values for properties that don't have the expected type.");
+                                        }
+                                        Console.WriteLine("* Object shape test 2: mismatched properties are flagged");
+
+                                        Console.WriteLine("Property Cache Tests: ");
+
+                                        // ... a cached value must be returned without calling back into managed code until it is invalidated ...
+
+                                        var cachedObject = _V8Engine.CreateObjectTemplate().CreateObject<CachedPropertyTester>();
+                                        _V8Engine.GlobalObject.SetProperty("cachedObject", cachedObject.InternalHandle);
+
+                                        int readCachedValue()
+                                        {
+                                            using (var result = _V8Engine.Execute("cachedObject.value", throwExceptionOnError: true))
+                                                return result.AsInt32;
+                                        }
+
+                                        cachedObject.Value = 1;
+                                        if (readCachedValue() != 1 || readCachedValue() != 1 || cachedObject.GetterCalls != 1)
+                                            throw new Exception("The property value was not cached after the first read.");
+
+                                        cachedObject.Value = 2;
+                                        if (readCachedValue() != 1)
+                                            throw new Exception("The cached property value was not used.");
+
+                                        cachedObject.InternalHandle.InvalidatePropertyCache("value");
+                                        if (readCachedValue() != 2 || cachedObject.GetterCalls != 2)
+                                            throw new Exception("Invalidating the property on the object did not drop the cached value.");
+
+                                        cachedObject.Value = 3;
+                                        _V8Engine.InvalidatePropertyCaches();
+                                        if (readCachedValue() != 3 || cachedObject.GetterCalls != 3)
+                                            throw new Exception("Invalidating all property caches did not drop the cached value.");
+
+                                        cachedObject.Value = 4;
+                                        _V8Engine.Execute("cachedObject.value = 0;", throwExceptionOnError: true).Dispose();
+                                        if (readCachedValue() != 4 || cachedObject.GetterCalls != 4)
+                                            throw new Exception("Setting the property from a script did not drop the cached value.");
+                                        Console.WriteLine("* Property cache test 1: " + cachedObject.GetterCalls + " getter calls");
+
+                                        Console.WriteLine("Primitive Callback Tests: ");
+
+                                        // ... calls that match the signature must use the primitive callback, and anything else the regular callback ...
+
+                                        var primitiveCalls = 0;
+                                        var regularCalls = 0;
+                                        var sumTemplate = _V8Engine.CreateFunctionTemplate("sum");
+                                        _V8Engine.DynamicGlobalObject.sum = sumTemplate.GetFunctionObject((sumEngine, isConstructCall, sumThis, sumArgs) => { regularCalls++; return sumEngine.CreateValue("regular"); });
+                                        sumTemplate.SetPrimitiveCallback((PrimitiveInt32Function2)((a, b) => { primitiveCalls++; return a + b; }));
+
+                                        string callSum(string call)
+                                        {
+                                            using (var result = _V8Engine.Execute(call, throwExceptionOnError: true))
+                                                return result.AsString;
+                                        }
+
+                                        if (callSum("sum(1, 2)") != "3" || primitiveCalls != 1 || regularCalls != 0)
+                                            throw new Exception("A call matching the signature did not use the primitive callback.");
+
+                                        if (callSum("sum(1.5, 2)") != "regular" || callSum("sum('1', 2)") != "regular" || callSum("sum(1)") != "regular"
+                                            || callSum("typeof new sum(1, 2)") != "object" || primitiveCalls != 1 || regularCalls != 4)
+                                            throw new Exception("A call not matching the signature did not fall back to the regular callback.");
+
+                                        sumTemplate.ClearPrimitiveCallback();
+                                        if (callSum("sum(1, 2)") != "regular" || primitiveCalls != 1 || regularCalls != 5)
+                                            throw new Exception("Clearing the primitive callback did not restore the regular callback.");
+                                        Console.WriteLine("* Primitive callback test 1: " + primitiveCalls + " primitive call(s), " + regularCalls + " regular call(s)");
+
+                                        Console.WriteLine("Chunked String Read Tests: ");
+
+                                        // ... ranges must be copied exactly, clipped at the end of the string, and non-strings must report -1 ...
+
+                                        using (var text = _V8Engine.CreateValue("Hello, world!"))
+                                        using (var number = _V8Engine.CreateValue(123))
+                                        {
+                                            if (text.StringLength != 13)
+                                                throw new Exception("The string length is wrong: " + text.StringLength);
+
+                                            var chars = new char[8];
+                                            if (text.ReadString(7, chars, 1, 5) != 5 || new string(chars, 1, 5) != "world")
+                                                throw new Exception("A range was not read correctly.");
+
+                                            if (text.ReadString(10, chars, 0, 8) != 3 || new string(chars, 0, 3) != "ld!")
+                                                throw new Exception("A read past the end of the string was not clipped.");
+
+                                            if (text.ReadString(13, chars, 0, 8) != 0)
+                                                throw new Exception("A read at the end of the string did not return 0.");
+
+                                            if (number.StringLength != -1 || number.ReadString(0, chars, 0, 8) != -1 || number.WriteString(new StringWriter()))
+                                                throw new Exception("A non-string handle was read as a string.");
+
+                                            expectException<ArgumentOutOfRangeException>(() => text.ReadString(0, chars, 4, 5), "A range outside the buffer was accepted.");
+
+                                            var writer = new StringWriter();
+                                            if (!text.WriteString(writer, chunkSize: 4) || writer.ToString() != "Hello, world!")
+                                                throw new Exception("The chunked write did not reproduce the string: " + writer);
+                                        }
+                                        Console.WriteLine("* Chunked string read test 1: OK");
                                     }
 
                                     Console.WriteLine("\r\n===============================================================================\r\n");
@@ -573,6 +860,263 @@ namespace V8.Net
                                 Console.WriteLine("\r\nUpdating native properties is {0:N2}x faster than managed ones.", result3 / result1);
                                 Console.WriteLine("\r\nReading native properties is {0:N2}x faster than managed ones.", result4 / result2);
 
+                                // ... accessors (no interceptors on these templates, so only the accessor dispatch is measured) ...
+
+                                var accessorTemplate = _V8Engine.CreateObjectTemplate<ObjectTemplate>(false);
+                                accessorTemplate.SetAccessor("value", (_this, name) => _V8Engine.CreateValue(1), null);
+                                var accessorObject = accessorTemplate.CreateObject<V8NativeObject>();
+                                _V8Engine.DynamicGlobalObject.ao = accessorObject;
+
+                                Console.WriteLine("\r\nTesting property read speed using a managed accessor ... ");
+                                startTime = timer.ElapsedMilliseconds;
+                                _V8Engine.Execute("for (o.i=0; o.i<" + count + "; o.i++) ao.value;");
+                                elapsed = timer.ElapsedMilliseconds - startTime;
+                                result1 = (double)elapsed / count;
+                                Console.WriteLine(count + " loops @ " + elapsed + "ms total = " + result1.ToString("0.0#########") + " ms each pass.");
+
+                                var directTemplate = _V8Engine.CreateObjectTemplate<ObjectTemplate>(false);
+                                directTemplate.SetDirectAccessor("value", 0, DirectAccessorType.Int32);
+                                var directObject = directTemplate.CreateObject<V8NativeObject>();
+                                var directData = System.Runtime.InteropServices.Marshal.AllocHGlobal(sizeof(Int32));
+                                System.Runtime.InteropServices.Marshal.WriteInt32(directData, 1);
+                                ((InternalHandle)directObject).SetDataPointer(directData);
+                                _V8Engine.DynamicGlobalObject.dao = directObject;
+
+                                Console.WriteLine("\r\nTesting property read speed using a direct (native memory) accessor ... ");
+                                startTime = timer.ElapsedMilliseconds;
+                                _V8Engine.Execute("for (o.i=0; o.i<" + count + "; o.i++) dao.value;");
+                                elapsed = timer.ElapsedMilliseconds - startTime;
+                                result2 = (double)elapsed / count;
+                                Console.WriteLine(count + " loops @ " + elapsed + "ms total = " + result2.ToString("0.0#########") + " ms each pass.");
+
+                                Console.WriteLine("\r\nTesting property write speed using a direct (native memory) accessor ... ");
+                                startTime = timer.ElapsedMilliseconds;
+                                _V8Engine.Execute("for (o.i=0; o.i<" + count + "; o.i++) dao.value = o.i;");
+                                elapsed = timer.ElapsedMilliseconds - startTime;
+                                result3 = (double)elapsed / count;
+                                Console.WriteLine(count + " loops @ " + elapsed + "ms total = " + result3.ToString("0.0#########") + " ms each pass.");
+
+                                ((InternalHandle)directObject).SetDataPointer(IntPtr.Zero);
+                                System.Runtime.InteropServices.Marshal.FreeHGlobal(directData);
+
+                                Console.WriteLine("\r\nReading direct accessors is {0:N2}x faster than managed accessors.", result1 / result2);
+
+                                // ... function calls ...
+
+                                var addTemplate = _V8Engine.CreateFunctionTemplate("add");
+                                var addFunction = addTemplate.GetFunctionObject((engine, isConstructCall, _this, args) => engine.CreateValue(args[0].AsDouble + args[1].AsDouble));
+                                _V8Engine.DynamicGlobalObject.add = addFunction;
+
+                                Console.WriteLine("\r\nTesting function call speed using a managed callback ... ");
+                                var argumentStats = _V8Engine.GetArgumentBufferStats();
+                                startTime = timer.ElapsedMilliseconds;
+                                _V8Engine.Execute("for (o.i=0; o.i<" + count + "; o.i++) add(o.i, 0.5);");
+                                elapsed = timer.ElapsedMilliseconds - startTime;
+                                result1 = (double)elapsed / count;
+                                Console.WriteLine(count + " loops @ " + elapsed + "ms total = " + result1.ToString("0.0#########") + " ms each pass.");
+                                Console.WriteLine("Argument buffer heap allocations during the test: " + (_V8Engine.GetArgumentBufferStats().HeapAllocations - argumentStats.HeapAllocations) + ".");
+
+                                addTemplate.SetPrimitiveCallback((PrimitiveNumberFunction2)((a, b) => a + b));
+
+                                Console.WriteLine("\r\nTesting function call speed using a primitive callback ... ");
+                                startTime = timer.ElapsedMilliseconds;
+                                _V8Engine.Execute("for (o.i=0; o.i<" + count + "; o.i++) add(o.i, 0.5);");
+                                elapsed = timer.ElapsedMilliseconds - startTime;
+                                result2 = (double)elapsed / count;
+                                Console.WriteLine(count + " loops @ " + elapsed + "ms total = " + result2.ToString("0.0#########") + " ms each pass.");
+
+                                Console.WriteLine("\r\nCalling primitive callbacks is {0:N2}x faster than managed callbacks.", result1 / result2);
+
+                                addTemplate.ClearPrimitiveCallback();
+                                addTemplate.SetArgumentsCallback((engine, isConstructCall, args) =>
+                                    args.TryGetNumber(0, out var a) && args.TryGetNumber(1, out var b) ? engine.CreateValue(a + b) : InternalHandle.Empty);
+
+                                Console.WriteLine("\r\nTesting function call speed using a managed callback with an arguments view ... ");
+                                startTime = timer.ElapsedMilliseconds;
+                                _V8Engine.Execute("for (o.i=0; o.i<" + count + "; o.i++) add(o.i, 0.5);");
+                                elapsed = timer.ElapsedMilliseconds - startTime;
+                                result2 = (double)elapsed / count;
+                                Console.WriteLine(count + " loops @ " + elapsed + "ms total = " + result2.ToString("0.0#########") + " ms each pass.");
+
+                                Console.WriteLine("\r\nCalling managed callbacks with an arguments view is {0:N2}x faster than with handles.", result1 / result2);
+
+#if DEBUG
+                                count = 1000;
+#else
+                                count = 100000;
+#endif
+
+                                var document = new Dictionary<string, object>
+                                {
+                                    { "id", 12345 },
+                                    { "name", "Some product name" },
+                                    { "price", 19.99 },
+                                    { "active", true },
+                                    { "created", DateTime.UtcNow },
+                                    { "tags", new[] { "one", "two", "three" } },
+                                    { "address", new Dictionary<string, object> { { "street", "1 Main St" }, { "city", "Springfield" }, { "country", "US" } } }
+                                };
+
+                                InternalHandle createPerProperty(Dictionary<string, object> properties)
+                                {
+                                    var obj = _V8Engine.CreateObject();
+                                    foreach (var property in properties)
+                                    {
+                                        InternalHandle value;
+                                        if (property.Value is Dictionary<string, object> child)
+                                            value = createPerProperty(child);
+                                        else if (property.Value is string[] items)
+                                            value = _V8Engine.CreateValue((IEnumerable<string>)items);
+                                        else
+                                            value = _V8Engine.CreateValue(property.Value);
+                                        obj.SetProperty(property.Key, value);
+                                        value.Dispose();
+                                    }
+                                    return obj;
+                                }
+
+                                void readPerProperty(InternalHandle obj, Dictionary<string, object> properties)
+                                {
+                                    foreach (var property in properties)
+                                    {
+                                        var value = obj.GetProperty(property.Key);
+                                        if (property.Value is Dictionary<string, object> child)
+                                            readPerProperty(value, child);
+                                        else if (property.Value is string[] items)
+                                            for (var i = 0; i < items.Length; i++)
+                                            {
+                                                var item = value.GetProperty(i);
+                                                _ = item.Value;
+                                                item.Dispose();
+                                            }
+                                        else
+                                        {
+                                            _ = value.Value;
+                                        }
+                                        value.Dispose();
+                                    }
+                                }
+
+                                Console.WriteLine("\r\nTesting document creation speed, one property at a time ... ");
+                                startTime = timer.ElapsedMilliseconds;
+                                for (var i = 0; i < count; i++)
+                                    createPerProperty(document).Dispose();
+                                elapsed = timer.ElapsedMilliseconds - startTime;
+                                result1 = (double)elapsed / count;
+                                Console.WriteLine(count + " documents @ " + elapsed + "ms total = " + result1.ToString("0.0#########") + " ms each.");
+
+                                Console.WriteLine("\r\nTesting document creation speed using the binary serializer ... ");
+                                startTime = timer.ElapsedMilliseconds;
+                                for (var i = 0; i < count; i++)
+                                    ObjectSerializer.CreateValue(_V8Engine, document).Dispose();
+                                elapsed = timer.ElapsedMilliseconds - startTime;
+                                result2 = (double)elapsed / count;
+                                Console.WriteLine(count + " documents @ " + elapsed + "ms total = " + result2.ToString("0.0#########") + " ms each.");
+
+                                var hDocument = ObjectSerializer.CreateValue(_V8Engine, document);
+
+                                Console.WriteLine("\r\nTesting document read speed, one property at a time ... ");
+                                startTime = timer.ElapsedMilliseconds;
+                                for (var i = 0; i < count; i++)
+                                    readPerProperty(hDocument, document);
+                                elapsed = timer.ElapsedMilliseconds - startTime;
+                                result3 = (double)elapsed / count;
+                                Console.WriteLine(count + " documents @ " + elapsed + "ms total = " + result3.ToString("0.0#########") + " ms each.");
+
+                                Console.WriteLine("\r\nTesting document read speed using the binary serializer ... ");
+                                startTime = timer.ElapsedMilliseconds;
+                                for (var i = 0; i < count; i++)
+                                    ObjectSerializer.Read(hDocument);
+                                elapsed = timer.ElapsedMilliseconds - startTime;
+                                result4 = (double)elapsed / count;
+                                Console.WriteLine(count + " documents @ " + elapsed + "ms total = " + result4.ToString("0.0#########") + " ms each.");
+
+                                hDocument.Dispose();
+
+                                Console.WriteLine("\r\nCreating documents using the serializer is {0:N2}x faster than one property at a time.", result1 / result2);
+                                Console.WriteLine("\r\nReading documents using the serializer is {0:N2}x faster than one property at a time.", result3 / result4);
+
+#if DEBUG
+                                count = 100000;
+#else
+                                count = 1000000;
+#endif
+
+                                Console.WriteLine("\r\nTesting native call speed (creating and disposing values) ... ");
+                                startTime = timer.ElapsedMilliseconds;
+                                for (var i = 0; i < count; i++)
+                                    _V8Engine.CreateValue(i).Dispose();
+                                elapsed = timer.ElapsedMilliseconds - startTime;
+                                result1 = (double)elapsed / count;
+                                Console.WriteLine(count + " values @ " + elapsed + "ms total = " + result1.ToString("0.0#########") + " ms each.");
+
+                                using (var affineEngine = new V8Engine(true, V8EngineFlags.ThreadAffine))
+                                {
+                                    Console.WriteLine("\r\nTesting native call speed on a thread-affine engine (no locker per call) ... ");
+                                    startTime = timer.ElapsedMilliseconds;
+                                    for (var i = 0; i < count; i++)
+                                        affineEngine.CreateValue(i).Dispose();
+                                    elapsed = timer.ElapsedMilliseconds - startTime;
+                                    result2 = (double)elapsed / count;
+                                    Console.WriteLine(count + " values @ " + elapsed + "ms total = " + result2.ToString("0.0#########") + " ms each.");
+                                }
+
+                                Console.WriteLine("\r\nNative calls on a thread-affine engine are {0:N2}x faster.", result1 / result2);
+
+#if DEBUG
+                                count = 10000;
+#else
+                                count = 100000;
+#endif
+
+                                Action createObjectWithProperties = () =>
+                                {
+                                    using (var newObject = _V8Engine.CreateObject())
+                                    {
+                                        for (var propertyIndex = 0; propertyIndex < 20; propertyIndex++)
+                                            using (var propertyValue = _V8Engine.CreateValue(propertyIndex))
+                                                newObject.SetProperty("p" + propertyIndex, propertyValue);
+                                    }
+                                };
+
+                                Console.WriteLine("\r\nTesting object creation speed (20 properties each) ... ");
+                                startTime = timer.ElapsedMilliseconds;
+                                for (var i = 0; i < count; i++)
+                                    createObjectWithProperties();
+                                elapsed = timer.ElapsedMilliseconds - startTime;
+                                result1 = (double)elapsed / count;
+                                Console.WriteLine(count + " objects @ " + elapsed + "ms total = " + result1.ToString("0.0#########") + " ms each.");
+
+                                Console.WriteLine("\r\nTesting object creation speed (20 properties each) within an engine session ... ");
+                                startTime = timer.ElapsedMilliseconds;
+                                for (var i = 0; i < count; i++)
+                                    using (_V8Engine.BeginSession())
+                                        createObjectWithProperties();
+                                elapsed = timer.ElapsedMilliseconds - startTime;
+                                result2 = (double)elapsed / count;
+                                Console.WriteLine(count + " objects @ " + elapsed + "ms total = " + result2.ToString("0.0#########") + " ms each.");
+
+                                Console.WriteLine("\r\nCreating objects within a session is {0:N2}x faster.", result1 / result2);
+
+                                var nameIDs = new Int32[20];
+                                for (var propertyIndex = 0; propertyIndex < 20; propertyIndex++)
+                                    nameIDs[propertyIndex] = _V8Engine.RegisterCommandName("p" + propertyIndex);
+
+                                var commands = new CommandBuffer().CreateObject();
+                                for (var propertyIndex = 0; propertyIndex < 20; propertyIndex++)
+                                    commands.Push(propertyIndex).SetProperty(nameIDs[propertyIndex]);
+                                commands.Pop();
+
+                                Console.WriteLine("\r\nTesting object creation speed (20 properties each) using a command buffer ... ");
+                                startTime = timer.ElapsedMilliseconds;
+                                for (var i = 0; i < count; i++)
+                                    commands.Execute(_V8Engine);
+                                elapsed = timer.ElapsedMilliseconds - startTime;
+                                result2 = (double)elapsed / count;
+                                Console.WriteLine(count + " objects @ " + elapsed + "ms total = " + result2.ToString("0.0#########") + " ms each.");
+
+                                Console.WriteLine("\r\nCreating objects using a command buffer is {0:N2}x faster.", result1 / result2);
+
                                 Console.WriteLine("\r\nDone.\r\n");
                                 o = null;
                             }
@@ -1027,6 +1571,22 @@ public class SamplePointFunctionTemplate : FunctionTemplate
     }
 }
 
+// Counts the calls to its getter for 'value', so the tests can tell when the value was returned from the native property cache.
+public class CachedPropertyTester : V8ManagedObject, IV8CacheableProperties
+{
+    public int Value;
+    public int GetterCalls;
+
+    public override InternalHandle NamedPropertyGetter(ref string propertyName)
+    {
+        if (propertyName != "value") return base.NamedPropertyGetter(ref propertyName);
+        GetterCalls++;
+        return Engine.CreateValue(Value);
+    }
+
+    public bool IsPropertyCacheable(string propertyName, InternalHandle value) { return propertyName == "value"; }
+}
+
 
 
 //!!public class __UsageExamplesScratchArea__ // (just here to help with writing examples for documentation, etc.)